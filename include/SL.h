@@ -1,22 +1,34 @@
-#ifndef __SL_H__
-#define __SL_H__
-
-#include "SL/structures.h"
-
-#include "SL/maths/constants.h"
-#include "SL/maths/math.h"
-#include "SL/maths/vector.h"
-#include "SL/maths/quaternion.h"
-#include "SL/maths/matrix.h"
-
-#include "SL/utils/inout.h"
-#include "SL/utils/list.h"
-#include "SL/utils/array.h"
-#include "SL/utils/imageImporter.h"
-#include "SL/utils/arenaAlloc.h"
-#include "SL/utils/hashtbl.h"
-#include "SL/utils/argument.h"
-
-#include "SL/utils/iter_def.h"
-
-#endif
+#ifndef __SL_H__
+#define __SL_H__
+
+#include "SL/structures.h"
+
+#include "SL/maths/constants.h"
+#include "SL/maths/math.h"
+#include "SL/maths/random.h"
+#include "SL/maths/sequence.h"
+#include "SL/maths/noise.h"
+#include "SL/maths/vector.h"
+#include "SL/maths/quaternion.h"
+#include "SL/maths/matrix.h"
+#include "SL/maths/dualQuaternion.h"
+#include "SL/maths/animation.h"
+#include "SL/maths/terrain.h"
+
+#include "SL/utils/inout.h"
+#include "SL/utils/list.h"
+#include "SL/utils/array.h"
+#include "SL/utils/segArray.h"
+#include "SL/utils/deque.h"
+#include "SL/utils/imageImporter.h"
+#include "SL/utils/arenaAlloc.h"
+#include "SL/utils/hashtbl.h"
+#include "SL/utils/argument.h"
+#include "SL/utils/threadPool.h"
+
+#include "SL/utils/iter_def.h"
+#include "SL/utils/bitset.h"
+#include "SL/utils/search.h"
+#include "SL/utils/mappedArray.h"
+
+#endif
@@ -1,25 +1,37 @@
-gcc -c utils/inout.c
-gcc -c utils/list.c
-gcc -c utils/array.c
-@REM gcc -c utils/imageImporter.c -D SL_DONT_USE_PNG
-gcc -c utils/imageImporter.c
-gcc -c utils/arenaAlloc.c
-gcc -c utils/hashtbl.c
-gcc -c utils/argument.c
-@REM gcc -c utils/puff.c -D SL_DONT_USE_PNG
-gcc -c utils/puff.c
-
-gcc -c maths/math.c
-gcc -c maths/vector.c
-gcc -c maths/quaternion.c
-gcc -c maths/matrix.c
-
-ar rc libSL.a **.o
-ranlib libSL.a
-
-copy libSL.a C:\msys64\mingw64\lib\libSL.a
-del libSL.a
-del **.o
-
-nm C:\msys64\mingw64\lib\libSL.a
+gcc -c utils/inout.c
+gcc -c utils/list.c
+gcc -c utils/array.c
+gcc -c utils/segArray.c
+gcc -c utils/deque.c
+@REM gcc -c utils/imageImporter.c -D SL_DONT_USE_PNG
+gcc -c utils/imageImporter.c
+gcc -c utils/arenaAlloc.c
+gcc -c utils/hashtbl.c
+gcc -c utils/argument.c
+gcc -c utils/threadPool.c
+gcc -c utils/bitset.c
+gcc -c utils/search.c
+gcc -c utils/mappedArray.c
+@REM gcc -c utils/puff.c -D SL_DONT_USE_PNG
+gcc -c utils/puff.c
+
+gcc -c maths/math.c
+gcc -c maths/random.c -fno-math-errno
+gcc -c maths/sequence.c
+gcc -c maths/noise.c -ffp-contract=off
+gcc -c maths/vector.c
+gcc -c maths/quaternion.c
+gcc -c maths/matrix.c
+gcc -c maths/dualQuaternion.c
+gcc -c maths/animation.c
+gcc -c maths/terrain.c -ffp-contract=off
+
+ar rc libSL.a **.o
+ranlib libSL.a
+
+copy libSL.a C:\msys64\mingw64\lib\libSL.a
+del libSL.a
+del **.o
+
+nm C:\msys64\mingw64\lib\libSL.a
 pause
\ No newline at end of file
@@ -0,0 +1,200 @@
+#include "animation.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include "../utils/array.h"
+#include "../utils/inout.h"
+
+anim_track3 createAnimTrack3(uint capacity) {
+    return (anim_track3) {
+        .times = createArray(array(float), capacity),
+        .values = createArray(array(vec3), capacity)
+    };
+}
+void destroyAnimTrack3(anim_track3 toDestroy) {
+    destroyArray(toDestroy.times);
+    destroyArray(toDestroy.values);
+}
+void animTrack3AddKey(anim_track3* track, float time, vec3 value) {
+    arrayAdd(track->times, time);
+    arrayAdd(track->values, value);
+}
+
+anim_trackQ createAnimTrackQ(uint capacity) {
+    return (anim_trackQ) {
+        .times = createArray(array(float), capacity),
+        .values = createArray(array(quat), capacity)
+    };
+}
+void destroyAnimTrackQ(anim_trackQ toDestroy) {
+    destroyArray(toDestroy.times);
+    destroyArray(toDestroy.values);
+}
+void animTrackQAddKey(anim_trackQ* track, float time, quat value) {
+    arrayAdd(track->times, time);
+    arrayAdd(track->values, value);
+}
+
+// Number of keys walked linearly before falling back to a binary search
+#define ANIM_SEEK_LINEAR 4
+
+uint animSeekKey(const float* times, uint count, float t, anim_cursor cursor) {
+    if (count < 2) return 0;
+    const uint last = count - 2;
+    if (cursor > last) cursor = last;
+
+    uint lo, hi;
+    if (t >= times[cursor]) {
+        // Playing forward: the answer is almost always the cursor or one of the next few keys
+        for (uint i = 0; i < ANIM_SEEK_LINEAR; i++) {
+            if (cursor == last || t < times[cursor + 1]) return cursor;
+            ++cursor;
+        }
+        if (cursor == last || t < times[cursor + 1]) return cursor;
+        lo = cursor + 1; hi = last + 1;
+    }
+    else {
+        if (cursor == 0 || t >= times[cursor - 1]) return cursor == 0 ? 0 : cursor - 1;
+        if (t < times[0]) return 0;
+        lo = 0; hi = cursor - 1;
+    }
+
+    // times[lo] <= t, and either hi == last + 1 or t < times[hi]
+    while (hi - lo > 1) {
+        uint mid = (lo + hi) >> 1;
+        if (times[mid] <= t) lo = mid;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Index of the first key and interpolation factor towards the next one
+static inline float animKeyFactor(const float* times, uint count, float t, anim_cursor* cursor) {
+    uint k = *cursor = animSeekKey(times, count, t, *cursor);
+    if (count < 2) return 0.0f;
+
+    float span = times[k + 1] - times[k];
+    float u = span > 0.0f ? (t - times[k]) / span : 1.0f;
+    return u < 0.0f ? 0.0f : (u > 1.0f ? 1.0f : u);
+}
+
+vec3 animTrack3Sample(const anim_track3* track, float t, anim_cursor* cursor) {
+    uint count = track->times.count;
+    if (count == 0) return vec3_zero;
+
+    float u = animKeyFactor(track->times.data, count, t, cursor);
+    if (count == 1) return track->values.data[0];
+    return lerp3(track->values.data[*cursor], track->values.data[*cursor + 1], u);
+}
+quat animTrackQSample(const anim_trackQ* track, float t, anim_cursor* cursor) {
+    uint count = track->times.count;
+    if (count == 0) return quat_identity;
+
+    float u = animKeyFactor(track->times.data, count, t, cursor);
+    if (count == 1) return track->values.data[0];
+
+    const quat a = track->values.data[*cursor];
+    const quat b = track->values.data[*cursor + 1];
+    float s = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z < 0.0f ? -u : u;
+    float r = 1.0f - u;
+    quat q = {a.w * r + b.w * s, a.x * r + b.x * s, a.y * r + b.y * s, a.z * r + b.z * s};
+    return scaleQ(q, 1.0f / sqrtf(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z));
+}
+
+
+
+///// BATCH SAMPLING
+
+// Number of samples gathered before each interpolation pass
+#define ANIM_BATCH_BLOCK 64
+
+static void* animBatchAlloc(size_t size) {
+    void* new = malloc(size);
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate animation samples!");
+    return new;
+}
+
+vec3* animTrack3Sample_Batch(const anim_track3* tracks, uint trackCount, const float* times, uint instanceCount, anim_cursor* cursors, vec3* restrict destination) {
+    const uint total = trackCount * instanceCount;
+    if (destination == NULL) destination = animBatchAlloc(total * sizeof(vec3));
+
+    float ax[ANIM_BATCH_BLOCK], ay[ANIM_BATCH_BLOCK], az[ANIM_BATCH_BLOCK];
+    float bx[ANIM_BATCH_BLOCK], by[ANIM_BATCH_BLOCK], bz[ANIM_BATCH_BLOCK];
+    float u[ANIM_BATCH_BLOCK];
+
+    for (uint start = 0; start < total; start += ANIM_BATCH_BLOCK) {
+        const uint n = total - start < ANIM_BATCH_BLOCK ? total - start : ANIM_BATCH_BLOCK;
+
+        // Gather: seek every cursor and copy its key pair into SoA lanes
+        for (uint i = 0; i < n; i++) {
+            const uint k = start + i;
+            const anim_track3* track = tracks + k % trackCount;
+            const uint count = track->times.count;
+
+            vec3 a = vec3_zero, b = vec3_zero;
+            u[i] = 0.0f;
+            if (count) {
+                u[i] = animKeyFactor(track->times.data, count, times[k / trackCount], cursors + k);
+                a = track->values.data[cursors[k]];
+                b = count == 1 ? a : track->values.data[cursors[k] + 1];
+            }
+            ax[i] = a.x; ay[i] = a.y; az[i] = a.z;
+            bx[i] = b.x; by[i] = b.y; bz[i] = b.z;
+        }
+
+        // Interpolate: branch-free over the block
+        vec3* restrict out = destination + start;
+        for (uint i = 0; i < n; i++) {
+            out[i].x = ax[i] + (bx[i] - ax[i]) * u[i];
+            out[i].y = ay[i] + (by[i] - ay[i]) * u[i];
+            out[i].z = az[i] + (bz[i] - az[i]) * u[i];
+        }
+    }
+    return destination;
+}
+
+quat* animTrackQSample_Batch(const anim_trackQ* tracks, uint trackCount, const float* times, uint instanceCount, anim_cursor* cursors, quat* restrict destination) {
+    const uint total = trackCount * instanceCount;
+    if (destination == NULL) destination = animBatchAlloc(total * sizeof(quat));
+
+    float aw[ANIM_BATCH_BLOCK], ax[ANIM_BATCH_BLOCK], ay[ANIM_BATCH_BLOCK], az[ANIM_BATCH_BLOCK];
+    float bw[ANIM_BATCH_BLOCK], bx[ANIM_BATCH_BLOCK], by[ANIM_BATCH_BLOCK], bz[ANIM_BATCH_BLOCK];
+    float u[ANIM_BATCH_BLOCK];
+
+    for (uint start = 0; start < total; start += ANIM_BATCH_BLOCK) {
+        const uint n = total - start < ANIM_BATCH_BLOCK ? total - start : ANIM_BATCH_BLOCK;
+
+        // Gather: seek every cursor and copy its key pair into SoA lanes
+        for (uint i = 0; i < n; i++) {
+            const uint k = start + i;
+            const anim_trackQ* track = tracks + k % trackCount;
+            const uint count = track->times.count;
+
+            quat a = quat_identity, b = quat_identity;
+            u[i] = 0.0f;
+            if (count) {
+                u[i] = animKeyFactor(track->times.data, count, times[k / trackCount], cursors + k);
+                a = track->values.data[cursors[k]];
+                b = count == 1 ? a : track->values.data[cursors[k] + 1];
+            }
+            aw[i] = a.w; ax[i] = a.x; ay[i] = a.y; az[i] = a.z;
+            bw[i] = b.w; bx[i] = b.x; by[i] = b.y; bz[i] = b.z;
+        }
+
+        // Interpolate: shortest path nlerp, branch-free over the block
+        quat* restrict out = destination + start;
+        for (uint i = 0; i < n; i++) {
+            float d = aw[i] * bw[i] + ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+            float s = d < 0.0f ? -u[i] : u[i];
+            float r = 1.0f - u[i];
+
+            float w = aw[i] * r + bw[i] * s, x = ax[i] * r + bx[i] * s;
+            float y = ay[i] * r + by[i] * s, z = az[i] * r + bz[i] * s;
+            float inv = 1.0f / sqrtf(w * w + x * x + y * y + z * z);
+
+            out[i].w = w * inv; out[i].x = x * inv;
+            out[i].y = y * inv; out[i].z = z * inv;
+        }
+    }
+    return destination;
+}
\ No newline at end of file
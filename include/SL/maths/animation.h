@@ -0,0 +1,100 @@
+#ifndef __SL_MATHS_ANIMATION_H__
+#define __SL_MATHS_ANIMATION_H__
+
+#include "vector.h"
+#include "quaternion.h"
+#include "../utils/iter_def.h"
+
+/// @brief Keyframe track of vec3 values (positions, scales, ...)
+/// @note Keys are stored as two parallel arrays and must be sorted by time
+typedef struct AnimationTrack3 {
+    array(float) times;
+    array(vec3) values;
+} anim_track3;
+
+/// @brief Keyframe track of unit quaternions (rotations)
+/// @note Keys are stored as two parallel arrays and must be sorted by time
+typedef struct AnimationTrackQ {
+    array(float) times;
+    array(quat) values;
+} anim_trackQ;
+
+/// @brief Cached position of an instance inside of a track
+/// @note Start every cursor at 0, then let the sampling functions update it
+typedef uint anim_cursor;
+
+
+
+/// @brief Create a vec3 keyframe track
+/// @param capacity The initial number of keys the track can hold
+/// @return The newly created track
+anim_track3 createAnimTrack3(uint capacity);
+/// @brief Destroy a vec3 keyframe track
+/// @param toDestroy The track to destroy
+void destroyAnimTrack3(anim_track3 toDestroy);
+/// @brief Add a key at the end of a vec3 keyframe track
+/// @param track The track
+/// @param time The time of the key (must not be lower than the last one)
+/// @param value The value of the key
+void animTrack3AddKey(anim_track3* track, float time, vec3 value);
+
+/// @brief Create a quaternion keyframe track
+/// @param capacity The initial number of keys the track can hold
+/// @return The newly created track
+anim_trackQ createAnimTrackQ(uint capacity);
+/// @brief Destroy a quaternion keyframe track
+/// @param toDestroy The track to destroy
+void destroyAnimTrackQ(anim_trackQ toDestroy);
+/// @brief Add a key at the end of a quaternion keyframe track
+/// @param track The track
+/// @param time The time of the key (must not be lower than the last one)
+/// @param value The value of the key (supposed unit)
+void animTrackQAddKey(anim_trackQ* track, float time, quat value);
+
+/// @brief Find the key pair surrounding a time, starting from a cached cursor
+/// @param times The sorted key times
+/// @param count The number of keys
+/// @param t The time to look for
+/// @param cursor The last known key index
+/// @return The index i of the key such that times[i] <= t < times[i + 1] (clamped to the track)
+/// @note Constant time when t moves by a few keys from one call to the next, binary search otherwise
+uint animSeekKey(const float* times, uint count, float t, anim_cursor cursor);
+
+/// @brief Sample a vec3 keyframe track
+/// @param track The track
+/// @param t The time at which to sample (clamped to the track)
+/// @param cursor The cached cursor of the instance (updated)
+/// @return The linearly interpolated value
+vec3 animTrack3Sample(const anim_track3* track, float t, anim_cursor* cursor);
+/// @brief Sample a quaternion keyframe track
+/// @param track The track
+/// @param t The time at which to sample (clamped to the track)
+/// @param cursor The cached cursor of the instance (updated)
+/// @return The interpolated unit quaternion
+/// @note Uses normalized linear interpolation along the shortest path, which is indistinguishable from slerp for densely sampled keys
+quat animTrackQSample(const anim_trackQ* track, float t, anim_cursor* cursor);
+
+/// @brief Sample many vec3 tracks for many instances at once
+/// @param tracks The tracks
+/// @param trackCount The number of tracks
+/// @param times The time of each instance
+/// @param instanceCount The number of instances
+/// @param cursors The cursors, indexed [instance * trackCount + track] (updated)
+/// @param destination Where the results are stored, indexed [instance * trackCount + track]
+/// @note Set destination to NULL for new value (trackCount * instanceCount results)
+/// @note Keys are first gathered in SoA blocks, then interpolated in a single vectorizable pass
+/// @return The destination value
+vec3* animTrack3Sample_Batch(const anim_track3* tracks, uint trackCount, const float* times, uint instanceCount, anim_cursor* cursors, vec3* restrict destination);
+/// @brief Sample many quaternion tracks for many instances at once
+/// @param tracks The tracks
+/// @param trackCount The number of tracks
+/// @param times The time of each instance
+/// @param instanceCount The number of instances
+/// @param cursors The cursors, indexed [instance * trackCount + track] (updated)
+/// @param destination Where the results are stored, indexed [instance * trackCount + track]
+/// @note Set destination to NULL for new value (trackCount * instanceCount results)
+/// @note Keys are first gathered in SoA blocks, then interpolated in a single vectorizable pass
+/// @return The destination value
+quat* animTrackQSample_Batch(const anim_trackQ* tracks, uint trackCount, const float* times, uint instanceCount, anim_cursor* cursors, quat* restrict destination);
+
+#endif
\ No newline at end of file
@@ -1,22 +1,27 @@
-#ifndef __SL_MATHS_CONSTANTS_H__
-#define __SL_MATHS_CONSTANTS_H__
-
-/// @brief The ratio of the circumference to the diameter
-#define PI 3.1415926535897931
-/// @brief The ratio of the circumference to the radius
-#define TAU 6.2831853071796
-/// @brief The ratio of 2*PI rad over 360°
-#define DEG_TO_RAD (PI / 180.0)
-/// @brief The ratio of 360° to 2*PI rad
-#define RAD_TO_DEG (180.0 / PI)
-
-/// @brief Euler's number, e
-#define EULER_NUM 2.7182818284590452
-
-/// @brief Golden ratio
-#define PHI 1.6180339887498948482045868
-
-#define FLOAT_MIN 1e-37f
-#define FLOAT_MAX 1e38f
-
+#ifndef __SL_MATHS_CONSTANTS_H__
+#define __SL_MATHS_CONSTANTS_H__
+
+/// @brief The ratio of the circumference to the diameter
+#define PI 3.1415926535897931
+/// @brief The ratio of the circumference to the radius
+#define TAU 6.2831853071796
+/// @brief The ratio of 2*PI rad over 360°
+#define DEG_TO_RAD (PI / 180.0)
+/// @brief The ratio of 360° to 2*PI rad
+#define RAD_TO_DEG (180.0 / PI)
+
+/// @brief Euler's number, e
+#define EULER_NUM 2.7182818284590452
+
+/// @brief Golden ratio
+#define PHI 1.6180339887498948482045868
+
+/// @brief Square root of 2
+#define SQRT2 1.4142135623730950488016887
+/// @brief Square root of 1/2
+#define SQRT1_2 0.7071067811865475244008444
+
+#define FLOAT_MIN 1e-37f
+#define FLOAT_MAX 1e38f
+
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "dualQuaternion.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+const dualquat dualquat_identity = {{1, 0, 0, 0}, {0, 0, 0, 0}};
+
+mat4x4* dualQuatTo4x4_(const dualquat* a, mat4x4* m) {
+    if (!m) m = newMat4x4();
+    const quat q = dualQuatGetRot(*a);
+    const vec3 p = dualQuatGetPos(*a);
+    m->r = m->c = 4;
+    return set4x4_Transform_(m, &p, &q, &vec3_one);
+}
+
+
+
+///// SKINNING
+
+// Number of vertices blended before each transform pass
+#define DQ_SKIN_BLOCK 64
+
+void skinDQ_Batch(const dualquat* bones, const vec3* positions, const vec3* normals, const uvec4* boneIds, const vec4* boneWeights, uint count, vec3* restrict outPositions, vec3* restrict outNormals) {
+    float rw[DQ_SKIN_BLOCK], rx[DQ_SKIN_BLOCK], ry[DQ_SKIN_BLOCK], rz[DQ_SKIN_BLOCK];
+    float dw[DQ_SKIN_BLOCK], dx[DQ_SKIN_BLOCK], dy[DQ_SKIN_BLOCK], dz[DQ_SKIN_BLOCK];
+    float px[DQ_SKIN_BLOCK], py[DQ_SKIN_BLOCK], pz[DQ_SKIN_BLOCK];
+    float nx[DQ_SKIN_BLOCK], ny[DQ_SKIN_BLOCK], nz[DQ_SKIN_BLOCK];
+
+    for (uint start = 0; start < count; start += DQ_SKIN_BLOCK) {
+        const uint n = count - start < DQ_SKIN_BLOCK ? count - start : DQ_SKIN_BLOCK;
+
+        // Blend: gather the 4 bones of every vertex, flipped into the hemisphere of the first one
+        for (uint i = 0; i < n; i++) {
+            const uvec4 id = boneIds[start + i];
+            const vec4 w = boneWeights[start + i];
+            const dualquat* b0 = bones + id.x, *b1 = bones + id.y, *b2 = bones + id.z, *b3 = bones + id.w;
+
+            #define DQ_SIGNED_WEIGHT(b, weight) ((b0->real.w * b->real.w + b0->real.x * b->real.x + b0->real.y * b->real.y + b0->real.z * b->real.z) < 0.0f ? -(weight) : (weight))
+            const float w0 = w.x, w1 = DQ_SIGNED_WEIGHT(b1, w.y), w2 = DQ_SIGNED_WEIGHT(b2, w.z), w3 = DQ_SIGNED_WEIGHT(b3, w.w);
+            #undef DQ_SIGNED_WEIGHT
+
+            rw[i] = b0->real.w * w0 + b1->real.w * w1 + b2->real.w * w2 + b3->real.w * w3;
+            rx[i] = b0->real.x * w0 + b1->real.x * w1 + b2->real.x * w2 + b3->real.x * w3;
+            ry[i] = b0->real.y * w0 + b1->real.y * w1 + b2->real.y * w2 + b3->real.y * w3;
+            rz[i] = b0->real.z * w0 + b1->real.z * w1 + b2->real.z * w2 + b3->real.z * w3;
+            dw[i] = b0->dual.w * w0 + b1->dual.w * w1 + b2->dual.w * w2 + b3->dual.w * w3;
+            dx[i] = b0->dual.x * w0 + b1->dual.x * w1 + b2->dual.x * w2 + b3->dual.x * w3;
+            dy[i] = b0->dual.y * w0 + b1->dual.y * w1 + b2->dual.y * w2 + b3->dual.y * w3;
+            dz[i] = b0->dual.z * w0 + b1->dual.z * w1 + b2->dual.z * w2 + b3->dual.z * w3;
+
+            px[i] = positions[start + i].x; py[i] = positions[start + i].y; pz[i] = positions[start + i].z;
+            if (normals) { nx[i] = normals[start + i].x; ny[i] = normals[start + i].y; nz[i] = normals[start + i].z; }
+        }
+
+        // Transform: normalize the blended dual quaternion and apply it, branch-free over the block
+        for (uint i = 0; i < n; i++) {
+            const float inv = 1.0f / sqrtf(rw[i] * rw[i] + rx[i] * rx[i] + ry[i] * ry[i] + rz[i] * rz[i]);
+            const float qw = rw[i] * inv, qx = rx[i] * inv, qy = ry[i] * inv, qz = rz[i] * inv;
+            const float ew = dw[i] * inv, ex = dx[i] * inv, ey = dy[i] * inv, ez = dz[i] * inv;
+
+            // p' = p + 2 r x (r x p + w p) + 2 (w d - dw r + r x d)
+            const float tx = qy * pz[i] - qz * py[i] + qw * px[i];
+            const float ty = qz * px[i] - qx * pz[i] + qw * py[i];
+            const float tz = qx * py[i] - qy * px[i] + qw * pz[i];
+            const float sx = qw * ex - ew * qx + (qy * ez - qz * ey);
+            const float sy = qw * ey - ew * qy + (qz * ex - qx * ez);
+            const float sz = qw * ez - ew * qz + (qx * ey - qy * ex);
+
+            px[i] += 2.0f * ((qy * tz - qz * ty) + sx);
+            py[i] += 2.0f * ((qz * tx - qx * tz) + sy);
+            pz[i] += 2.0f * ((qx * ty - qy * tx) + sz);
+        }
+        for (uint i = 0; i < n; i++) outPositions[start + i] = (vec3) {px[i], py[i], pz[i]};
+
+        if (!normals) continue;
+        for (uint i = 0; i < n; i++) {
+            const float inv = 1.0f / sqrtf(rw[i] * rw[i] + rx[i] * rx[i] + ry[i] * ry[i] + rz[i] * rz[i]);
+            const float qw = rw[i] * inv, qx = rx[i] * inv, qy = ry[i] * inv, qz = rz[i] * inv;
+
+            const float tx = qy * nz[i] - qz * ny[i] + qw * nx[i];
+            const float ty = qz * nx[i] - qx * nz[i] + qw * ny[i];
+            const float tz = qx * ny[i] - qy * nx[i] + qw * nz[i];
+
+            nx[i] += 2.0f * (qy * tz - qz * ty);
+            ny[i] += 2.0f * (qz * tx - qx * tz);
+            nz[i] += 2.0f * (qx * ty - qy * tx);
+        }
+        for (uint i = 0; i < n; i++) outNormals[start + i] = (vec3) {nx[i], ny[i], nz[i]};
+    }
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+#ifndef __SL_MATHS_DUAL_QUATERNION_H__
+#define __SL_MATHS_DUAL_QUATERNION_H__
+
+#include "vector.h"
+#include "quaternion.h"
+#include "matrix.h"
+
+/// @brief Dual quaternion real + ε dual, where ε² = 0
+/// @note A unit dual quaternion represents a rigid transform (rotation then translation)
+typedef struct DualQuaternion {
+    quat real;
+    quat dual;
+} dualquat;
+
+/// @brief The identity dual quaternion representing no transform
+extern const dualquat dualquat_identity;
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// STRUCT DUAL QUATERNIONS ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @brief Create a dual quaternion
+/// @param real The real part
+/// @param dual The dual part
+/// @return The newly created dual quaternion
+static inline dualquat DualQuat(const quat real, const quat dual) {
+    return (dualquat) {real, dual};
+}
+/// @brief Create a dual quaternion from a position and a rotation
+/// @param p The position (translation applied after the rotation)
+/// @param q The rotation (supposed unit)
+/// @return The newly created unit dual quaternion
+/// @note Same convention as set4x4_Transform_ (with unit scale) and rot3Q_
+static inline dualquat DualQuat_PosRot(const vec3 p, const quat q) {
+    // rot3Q_ rotates by the conjugate of q in Hamilton convention, so does the real part
+    const quat r = transpQ(q);
+    return (dualquat) {r, scaleQ(mulQ((quat) {0, p.x, p.y, p.z}, r), 0.5f)};
+}
+/// @brief Create a dual quaternion from a position only
+/// @param p The position
+/// @return The newly created unit dual quaternion
+static inline dualquat DualQuat_Pos(const vec3 p) {
+    return (dualquat) {{1, 0, 0, 0}, {0, p.x * 0.5f, p.y * 0.5f, p.z * 0.5f}};
+}
+
+/// @brief Add two dual quaternions
+/// @param a The left dual quaternion
+/// @param b The right dual quaternion
+/// @return The resulting dual quaternion
+static inline dualquat addDQ(const dualquat a, const dualquat b) {
+    return (dualquat) {addQ(a.real, b.real), addQ(a.dual, b.dual)};
+}
+/// @brief Scale a dual quaternion by a factor
+/// @param a The dual quaternion
+/// @param s The factor
+/// @return The resulting dual quaternion
+static inline dualquat scaleDQ(const dualquat a, float s) {
+    return (dualquat) {scaleQ(a.real, s), scaleQ(a.dual, s)};
+}
+/// @brief Multiply two dual quaternions (compose the transforms, b first)
+/// @param a The left dual quaternion
+/// @param b The right dual quaternion
+/// @return The resulting dual quaternion
+static inline dualquat mulDQ(const dualquat a, const dualquat b) {
+    quat d1 = mulQ(a.real, b.dual), d2 = mulQ(a.dual, b.real);
+    return (dualquat) {mulQ(a.real, b.real), {d1.w + d2.w, d1.x + d2.x, d1.y + d2.y, d1.z + d2.z}};
+}
+/// @brief Conjugate a dual quaternion
+/// @param a The dual quaternion
+/// @return The resulting dual quaternion
+/// @note For a unit dual quaternion, this is the inverse transform
+static inline dualquat transpDQ(const dualquat a) {
+    return (dualquat) {transpQ(a.real), transpQ(a.dual)};
+}
+/// @brief Normalize a dual quaternion
+/// @param a The dual quaternion
+/// @return The resulting unit dual quaternion
+static inline dualquat normDQ(const dualquat a) {
+    const quat r = a.real, d = a.dual;
+    float invLen = 1.0f / sqrtf(r.w * r.w + r.x * r.x + r.y * r.y + r.z * r.z);
+    float rd = (r.w * d.w + r.x * d.x + r.y * d.y + r.z * d.z) * invLen * invLen;
+
+    // Remove the part of the dual orthogonality constraint broken by blending
+    return (dualquat) {
+        scaleQ(r, invLen),
+        {(d.w - r.w * rd) * invLen, (d.x - r.x * rd) * invLen, (d.y - r.y * rd) * invLen, (d.z - r.z * rd) * invLen}
+    };
+}
+
+/// @brief Get the translation of a unit dual quaternion
+/// @param a The dual quaternion
+/// @return The translation
+static inline vec3 dualQuatGetPos(const dualquat a) {
+    const quat t = mulQ(a.dual, transpQ(a.real));
+    return Vec3(2.0f * t.x, 2.0f * t.y, 2.0f * t.z);
+}
+/// @brief Get the rotation of a unit dual quaternion
+/// @param a The dual quaternion
+/// @return The rotation (same convention as DualQuat_PosRot)
+static inline quat dualQuatGetRot(const dualquat a) {
+    return transpQ(a.real);
+}
+
+/// @brief Transform a point by a unit dual quaternion
+/// @param v The point
+/// @param a The dual quaternion
+/// @return The transformed point
+static inline vec3 transf3DQ(const vec3 v, const dualquat a) {
+    const vec3 rv = a.real.v, dv = a.dual.v;
+    const float rw = a.real.w, dw = a.dual.w;
+
+    // v + 2 r x (r x v + rw v) + 2 (rw d - dw r + r x d)
+    vec3 t = addS3(cross3(rv, v), v, rw);
+    vec3 p = add3(v, scale3(cross3(rv, t), 2.0f));
+    vec3 tr = add3(sub3(scale3(dv, rw), scale3(rv, dw)), cross3(rv, dv));
+    return addS3(p, tr, 2.0f);
+}
+/// @brief Rotate a direction by a unit dual quaternion (translation is ignored)
+/// @param v The direction
+/// @param a The dual quaternion
+/// @return The rotated direction
+static inline vec3 rot3DQ(const vec3 v, const dualquat a) {
+    const vec3 rv = a.real.v;
+    vec3 t = addS3(cross3(rv, v), v, a.real.w);
+    return add3(v, scale3(cross3(rv, t), 2.0f));
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// POINTER DUAL QUATERNIONS ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @brief Convert a unit dual quaternion to a transform matrix
+/// @param a The dual quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+mat4x4* dualQuatTo4x4_(const dualquat* a, mat4x4* destination);
+
+/// @brief Blend skinning with dual quaternions (up to 4 bones per vertex)
+/// @param bones The skinning transform of every bone
+/// @param positions The rest positions of the vertices
+/// @param normals The rest normals of the vertices (can be NULL)
+/// @param boneIds The 4 bone indices of each vertex
+/// @param boneWeights The 4 bone weights of each vertex (summing to 1, set unused weights to 0)
+/// @param count The number of vertices
+/// @param outPositions Where the skinned positions are stored
+/// @param outNormals Where the skinned normals are stored (ignored if normals is NULL)
+/// @note Unlike linear blending of matrices, this preserves volume around twisting joints (no "candy-wrapper")
+/// @note Vertices are blended in SoA blocks and transformed in a vectorizable loop
+void skinDQ_Batch(const dualquat* bones, const vec3* positions, const vec3* normals, const uvec4* boneIds, const vec4* boneWeights, uint count, vec3* restrict outPositions, vec3* restrict outNormals);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,1168 @@
+#include "noise.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include <limits.h>
+#include "../utils/inout.h"
+
+///// HASHES
+
+// Lattice hashes: nested PCG Hash on the integer coordinates (pure integer arithmetic, identical everywhere)
+static inline uint32 noiseHash2i(int x, int y) {
+    return SL_PCGHash((uint32)x + SL_PCGHash((uint32)y));
+}
+static inline uint32 noiseHash3i(int x, int y, int z) {
+    return SL_PCGHash((uint32)x + SL_PCGHash((uint32)y + SL_PCGHash((uint32)z)));
+}
+static inline uint32 noiseHash4i(int x, int y, int z, int w) {
+    return SL_PCGHash((uint32)x + SL_PCGHash((uint32)y + SL_PCGHash((uint32)z + SL_PCGHash((uint32)w))));
+}
+
+// Branch-free floor, exact for |x| < 2^31
+static inline int noiseFloor(float x) {
+    int i = (int)x;
+    return i - (x < (float)i);
+}
+
+// Bit pattern of a float, with -0 and +0 merged
+static inline uint32 noiseFloatBits(float f) {
+    union { float f; uint32 i; } u = {f + 0.0f};
+    return u.i;
+}
+// Top 24 bits of a hash as a float in [0, 1[ (exact conversion)
+static inline float noiseHashToFloat(uint32 h) {
+    return (float)(h >> 8) * (1.0f / 16777216.0f);
+}
+
+// Gradient directions, picked by the low bits of a lattice hash
+static const float noiseGrad2[16][2] = {
+    { 1.0f,         0.0f        }, { 0.92387953f,  0.38268343f}, { 0.70710678f,  0.70710678f}, { 0.38268343f,  0.92387953f},
+    { 0.0f,         1.0f        }, {-0.38268343f,  0.92387953f}, {-0.70710678f,  0.70710678f}, {-0.92387953f,  0.38268343f},
+    {-1.0f,         0.0f        }, {-0.92387953f, -0.38268343f}, {-0.70710678f, -0.70710678f}, {-0.38268343f, -0.92387953f},
+    { 0.0f,        -1.0f        }, { 0.38268343f, -0.92387953f}, { 0.70710678f, -0.70710678f}, { 0.92387953f, -0.38268343f}
+};
+// The 12 cube edge directions (normalized), 4 of them repeated to fill 16 entries
+static const float noiseGrad3[16][3] = {
+    { 0.70710678f,  0.70710678f,  0.0f}, {-0.70710678f,  0.70710678f,  0.0f}, { 0.70710678f, -0.70710678f,  0.0f}, {-0.70710678f, -0.70710678f,  0.0f},
+    { 0.70710678f,  0.0f,  0.70710678f}, {-0.70710678f,  0.0f,  0.70710678f}, { 0.70710678f,  0.0f, -0.70710678f}, {-0.70710678f,  0.0f, -0.70710678f},
+    { 0.0f,  0.70710678f,  0.70710678f}, { 0.0f, -0.70710678f,  0.70710678f}, { 0.0f,  0.70710678f, -0.70710678f}, { 0.0f, -0.70710678f, -0.70710678f},
+    { 0.70710678f,  0.70710678f,  0.0f}, {-0.70710678f,  0.70710678f,  0.0f}, { 0.0f, -0.70710678f,  0.70710678f}, { 0.0f, -0.70710678f, -0.70710678f}
+};
+// The 32 edge directions of the 4D hypercube (normalized)
+#define G4 0.57735027f
+static const float noiseGrad4[32][4] = {
+    { 0,  G4,  G4,  G4}, { 0,  G4,  G4, -G4}, { 0,  G4, -G4,  G4}, { 0,  G4, -G4, -G4},
+    { 0, -G4,  G4,  G4}, { 0, -G4,  G4, -G4}, { 0, -G4, -G4,  G4}, { 0, -G4, -G4, -G4},
+    { G4,  0,  G4,  G4}, { G4,  0,  G4, -G4}, { G4,  0, -G4,  G4}, { G4,  0, -G4, -G4},
+    {-G4,  0,  G4,  G4}, {-G4,  0,  G4, -G4}, {-G4,  0, -G4,  G4}, {-G4,  0, -G4, -G4},
+    { G4,  G4,  0,  G4}, { G4,  G4,  0, -G4}, { G4, -G4,  0,  G4}, { G4, -G4,  0, -G4},
+    {-G4,  G4,  0,  G4}, {-G4,  G4,  0, -G4}, {-G4, -G4,  0,  G4}, {-G4, -G4,  0, -G4},
+    { G4,  G4,  G4,  0}, { G4,  G4, -G4,  0}, { G4, -G4,  G4,  0}, { G4, -G4, -G4,  0},
+    {-G4,  G4,  G4,  0}, {-G4,  G4, -G4,  0}, {-G4, -G4,  G4,  0}, {-G4, -G4, -G4,  0}
+};
+#undef G4
+
+float hash21(vec2 p) {
+    return noiseHashToFloat(SL_PCGHash(noiseFloatBits(p.x) + SL_PCGHash(noiseFloatBits(p.y))));
+}
+float hash31(vec3 p) {
+    return noiseHashToFloat(SL_PCGHash(noiseFloatBits(p.x) + SL_PCGHash(noiseFloatBits(p.y) + SL_PCGHash(noiseFloatBits(p.z)))));
+}
+
+vec2 hash22(vec2 v) {
+    uint32 h = SL_PCGHash(noiseFloatBits(v.x) + SL_PCGHash(noiseFloatBits(v.y)));
+    return Vec2(noiseHashToFloat(h), noiseHashToFloat(SL_PCGHash(h)));
+}
+vec3 hash33(vec3 v) {
+    uint32 h1 = SL_PCGHash(noiseFloatBits(v.x) + SL_PCGHash(noiseFloatBits(v.y) + SL_PCGHash(noiseFloatBits(v.z))));
+    uint32 h2 = SL_PCGHash(h1);
+    return Vec3(noiseHashToFloat(h1), noiseHashToFloat(h2), noiseHashToFloat(SL_PCGHash(h2)));
+}
+
+vec2 hash2Unit2(vec2 v) {
+    const float* g = noiseGrad2[SL_PCGHash(noiseFloatBits(v.x) + SL_PCGHash(noiseFloatBits(v.y))) & 15];
+    return Vec2(g[0], g[1]);
+}
+vec3 hash3Unit3(vec3 v) {
+    const float* g = noiseGrad3[SL_PCGHash(noiseFloatBits(v.x) + SL_PCGHash(noiseFloatBits(v.y) + SL_PCGHash(noiseFloatBits(v.z)))) & 15];
+    return Vec3(g[0], g[1], g[2]);
+}
+
+// Feature point of a lattice cell, in [0, 1[ inside the cell
+static inline vec2 voronoiPoint2(int x, int y) {
+    uint32 h = noiseHash2i(x, y);
+    return Vec2(noiseHashToFloat(h), noiseHashToFloat(SL_PCGHash(h)));
+}
+static inline vec3 voronoiPoint3(int x, int y, int z) {
+    uint32 h1 = noiseHash3i(x, y, z), h2 = SL_PCGHash(h1);
+    return Vec3(noiseHashToFloat(h1), noiseHashToFloat(h2), noiseHashToFloat(SL_PCGHash(h2)));
+}
+
+// Dot product of the gradient of a lattice point with the offset to it
+static inline float perlinDot2(int x, int y, float dx, float dy) {
+    const uint32 h = noiseHash2i(x, y) & 15;
+    return noiseGrad2[h][0] * dx + noiseGrad2[h][1] * dy;
+}
+static inline float perlinDot3(int x, int y, int z, float dx, float dy, float dz) {
+    const uint32 h = noiseHash3i(x, y, z) & 15;
+    return noiseGrad3[h][0] * dx + noiseGrad3[h][1] * dy + noiseGrad3[h][2] * dz;
+}
+
+
+
+///// NOISE
+
+float SL_noise2D_voronoi(vec2 p) {
+    vec2 ip = floor2(p);
+    vec2 fp = sub2(p, ip);
+    const int ix = (int)ip.x, iy = (int)ip.y;
+
+    float minDist = 9.0f;
+    for(int x = -1; x <= 1; x++)
+    for(int y = -1; y <= 1; y++) {
+        vec2 h = voronoiPoint2(ix + x, iy + y);
+
+        // Distance to the midpoint between the sample and the random point of the cell
+        float dx = (h.x + (float)x + fp.x) * 0.5f - fp.x;
+        float dy = (h.y + (float)y + fp.y) * 0.5f - fp.y;
+        float md = dx * dx + dy * dy;
+
+        minDist = md < minDist ? md : minDist;
+    }
+
+    return sqrtf(minDist);
+}
+float SL_noise3D_voronoi(vec3 p) {
+    vec3 ip = floor3(p);
+    vec3 fp = sub3(p, ip);
+    const int ix = (int)ip.x, iy = (int)ip.y, iz = (int)ip.z;
+
+    float minDist = 27.0f;
+    for(int x = -1; x <= 1; x++)
+    for(int y = -1; y <= 1; y++)
+    for(int z = -1; z <= 1; z++) {
+        vec3 h = voronoiPoint3(ix + x, iy + y, iz + z);
+
+        // Distance to the midpoint between the sample and the random point of the cell
+        float dx = (h.x + (float)x + fp.x) * 0.5f - fp.x;
+        float dy = (h.y + (float)y + fp.y) * 0.5f - fp.y;
+        float dz = (h.z + (float)z + fp.z) * 0.5f - fp.z;
+        float md = dx * dx + dy * dy + dz * dz;
+
+        minDist = md < minDist ? md : minDist;
+    }
+
+    return sqrtf(minDist);
+}
+
+static inline float perlin2(float x, float y) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y);
+    const float u = x - (float)ix, v = y - (float)iy;
+    const float su = u * u * (3.0f - 2.0f * u), sv = v * v * (3.0f - 2.0f * v);
+
+    // dot products of the corner random vectors
+    float d00 = perlinDot2(ix,     iy,     u,        v       );
+    float d10 = perlinDot2(ix + 1, iy,     u - 1.0f, v       );
+    float d01 = perlinDot2(ix,     iy + 1, u,        v - 1.0f);
+    float d11 = perlinDot2(ix + 1, iy + 1, u - 1.0f, v - 1.0f);
+
+    // lerped in x, then in y
+    float d0 = d00 + (d10 - d00) * su;
+    float d1 = d01 + (d11 - d01) * su;
+    return d0 + (d1 - d0) * sv;
+}
+static inline float perlin3(float x, float y, float z) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z);
+    const float u = x - (float)ix, v = y - (float)iy, w = z - (float)iz;
+    const float su = u * u * (3.0f - 2.0f * u), sv = v * v * (3.0f - 2.0f * v), sw = w * w * (3.0f - 2.0f * w);
+
+    // dot products of the corner random vectors
+    float d000 = perlinDot3(ix,     iy,     iz,     u,        v,        w       );
+    float d100 = perlinDot3(ix + 1, iy,     iz,     u - 1.0f, v,        w       );
+    float d010 = perlinDot3(ix,     iy + 1, iz,     u,        v - 1.0f, w       );
+    float d110 = perlinDot3(ix + 1, iy + 1, iz,     u - 1.0f, v - 1.0f, w       );
+    float d001 = perlinDot3(ix,     iy,     iz + 1, u,        v,        w - 1.0f);
+    float d101 = perlinDot3(ix + 1, iy,     iz + 1, u - 1.0f, v,        w - 1.0f);
+    float d011 = perlinDot3(ix,     iy + 1, iz + 1, u,        v - 1.0f, w - 1.0f);
+    float d111 = perlinDot3(ix + 1, iy + 1, iz + 1, u - 1.0f, v - 1.0f, w - 1.0f);
+
+    // lerped in x
+    float d00 = d000 + (d100 - d000) * su;
+    float d10 = d010 + (d110 - d010) * su;
+    float d01 = d001 + (d101 - d001) * su;
+    float d11 = d011 + (d111 - d011) * su;
+
+    // lerped in y, then in z
+    float d0 = d00 + (d10 - d00) * sv;
+    float d1 = d01 + (d11 - d01) * sv;
+    return d0 + (d1 - d0) * sw;
+}
+
+float SL_noise2D_perlin(vec2 p) {
+    return perlin2(p.x, p.y);
+}
+float SL_noise3D_perlin(vec3 p) {
+    return perlin3(p.x, p.y, p.z);
+}
+
+
+
+///// GRID EVALUATION
+
+static void* noiseAlloc(size_t size) {
+    void* new = malloc(size);
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate noise grid!");
+    return new;
+}
+
+// Lattice cell of every sample along one axis of a grid (relative to the lowest one) and position inside it
+static void noiseGridAxis(float origin, float step, uint size, int* restrict cell, float* restrict frac, int* min, int* max) {
+    *min = INT_MAX; *max = INT_MIN;
+    for (uint i = 0; i < size; i++) {
+        float p = origin + step * (float)i;
+        float ip = floor(p);
+        cell[i] = (int)ip;
+        frac[i] = p - ip;
+        if (cell[i] < *min) *min = cell[i];
+        if (cell[i] > *max) *max = cell[i];
+    }
+    for (uint i = 0; i < size; i++) cell[i] -= *min;
+}
+
+// Lattice values cached over consecutive rows (2D) or planes (3D) of a grid
+typedef struct NoiseLattice {
+    int x0, y0;         // lattice position of the first cached value along x and y
+    uint nx, ny;        // number of cached values along x and y (ny is 1 for rows)
+    uint slotCount;     // number of consecutive rows or planes cached
+    int first;          // lattice position of slots[0]
+    float* slots[3];
+    void (*fill)(float* slot, int k, const struct NoiseLattice* l);
+} noise_lattice;
+
+static void noiseLatticeInit(noise_lattice* l, int first) {
+    for (uint i = 0; i < l->slotCount; i++) l->fill(l->slots[i], first + (int)i, l);
+    l->first = first;
+}
+// Move the window to start at "first", only recomputing the rows or planes not already cached
+static void noiseLatticeSlide(noise_lattice* l, int first) {
+    const int n = (int)l->slotCount;
+    const int shift = first - l->first;
+    if (shift == 0) return;
+    if (shift >= n || -shift >= n) {
+        noiseLatticeInit(l, first);
+        return;
+    }
+
+    float* old[3] = {l->slots[0], l->slots[1], l->slots[2]};
+    for (int i = 0; i < n; i++) l->slots[i] = old[(i + shift + n) % n];
+    if (shift > 0) for (int i = n - shift; i < n; i++) l->fill(l->slots[i], first + i, l);
+    else for (int i = 0; i < -shift; i++) l->fill(l->slots[i], first + i, l);
+    l->first = first;
+}
+
+static void perlinFill2(float* g, int y, const noise_lattice* l) {
+    for (uint i = 0; i < l->nx; i++) {
+        const float* r = noiseGrad2[noiseHash2i(l->x0 + (int)i, y) & 15];
+        g[i] = r[0]; g[i + l->nx] = r[1];
+    }
+}
+static void perlinFill3(float* g, int z, const noise_lattice* l) {
+    const uint n = l->nx * l->ny;
+    for (uint j = 0; j < l->ny; j++)
+    for (uint i = 0; i < l->nx; i++) {
+        const float* r = noiseGrad3[noiseHash3i(l->x0 + (int)i, l->y0 + (int)j, z) & 15];
+        const uint k = i + l->nx * j;
+        g[k] = r[0]; g[k + n] = r[1]; g[k + 2 * n] = r[2];
+    }
+}
+static void voronoiFill2(float* h, int y, const noise_lattice* l) {
+    for (uint i = 0; i < l->nx; i++) {
+        vec2 r = voronoiPoint2(l->x0 + (int)i, y);
+        h[i] = r.x; h[i + l->nx] = r.y;
+    }
+}
+static void voronoiFill3(float* h, int z, const noise_lattice* l) {
+    const uint n = l->nx * l->ny;
+    for (uint j = 0; j < l->ny; j++)
+    for (uint i = 0; i < l->nx; i++) {
+        vec3 r = voronoiPoint3(l->x0 + (int)i, l->y0 + (int)j, z);
+        const uint k = i + l->nx * j;
+        h[k] = r.x; h[k + n] = r.y; h[k + 2 * n] = r.z;
+    }
+}
+
+float* SL_noise2D_voronoi_Grid(vec2 origin, vec2 step, uvec2 size, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * size.x * size.y);
+    if (size.x == 0 || size.y == 0) return c;
+
+    int minX, maxX;
+    float* fx = noiseAlloc(size.x * (sizeof(float) + sizeof(int)));
+    int* cx = (int*)(fx + size.x);
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+
+    // Feature points of the rows above, at and below the samples, one cell wider on each side
+    noise_lattice l = {.x0 = minX - 1, .nx = maxX - minX + 3, .ny = 1, .slotCount = 3, .fill = voronoiFill2};
+    float* slots = noiseAlloc(sizeof(float) * 2 * l.nx * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 2 * l.nx * i;
+
+    for (uint y = 0; y < size.y; y++) {
+        const float py = origin.y + step.y * (float)y;
+        const float iy = floor(py);
+        const float fy = py - iy;
+        if (y == 0) noiseLatticeInit(&l, (int)iy - 1);
+        else noiseLatticeSlide(&l, (int)iy - 1);
+
+        float* restrict out = c + (size_t)size.x * y;
+        for (uint x = 0; x < size.x; x++) {
+            const int i = cx[x];
+            const float u = fx[x];
+
+            float minDist = 9.0f;
+            for (int oy = 0; oy < 3; oy++) {
+                const float* restrict hx = l.slots[oy], * restrict hy = hx + l.nx;
+                for (int ox = 0; ox < 3; ox++) {
+                    // Same operations as SL_noise2D_voronoi
+                    float dx = (hx[i + ox] + (float)(ox - 1) + u) * 0.5f - u;
+                    float dy = (hy[i + ox] + (float)(oy - 1) + fy) * 0.5f - fy;
+                    float md = dx * dx + dy * dy;
+                    minDist = md < minDist ? md : minDist;
+                }
+            }
+            out[x] = sqrtf(minDist);
+        }
+    }
+
+    free(fx); free(slots);
+    return c;
+}
+float* SL_noise3D_voronoi_Grid(vec3 origin, vec3 step, uvec3 size, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * size.x * size.y * size.z);
+    if (size.x == 0 || size.y == 0 || size.z == 0) return c;
+
+    int minX, maxX, minY, maxY;
+    float* fx = noiseAlloc((size.x + size.y) * (sizeof(float) + sizeof(int)));
+    float* fy = fx + size.x;
+    int* cx = (int*)(fy + size.y), * cy = cx + size.x;
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+    noiseGridAxis(origin.y, step.y, size.y, cy, fy, &minY, &maxY);
+
+    // Feature points of the planes above, at and below the samples, one cell wider on each side
+    noise_lattice l = {.x0 = minX - 1, .y0 = minY - 1, .nx = maxX - minX + 3, .ny = maxY - minY + 3, .slotCount = 3, .fill = voronoiFill3};
+    const uint n = l.nx * l.ny;
+    float* slots = noiseAlloc(sizeof(float) * 3 * n * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 3 * n * i;
+
+    for (uint z = 0; z < size.z; z++) {
+        const float pz = origin.z + step.z * (float)z;
+        const float iz = floor(pz);
+        const float w = pz - iz;
+        if (z == 0) noiseLatticeInit(&l, (int)iz - 1);
+        else noiseLatticeSlide(&l, (int)iz - 1);
+
+        for (uint y = 0; y < size.y; y++) {
+            const int j = cy[y];
+            const float v = fy[y];
+
+            float* restrict out = c + (size_t)size.x * (y + (size_t)size.y * z);
+            for (uint x = 0; x < size.x; x++) {
+                const int i = cx[x];
+                const float u = fx[x];
+
+                float minDist = 27.0f;
+                for (int oz = 0; oz < 3; oz++) {
+                    const float* restrict hx = l.slots[oz], * restrict hy = hx + n, * restrict hz = hy + n;
+                    for (int oy = 0; oy < 3; oy++)
+                    for (int ox = 0; ox < 3; ox++) {
+                        const uint k = (j + oy) * l.nx + i + ox;
+                        // Same operations as SL_noise3D_voronoi
+                        float dx = (hx[k] + (float)(ox - 1) + u) * 0.5f - u;
+                        float dy = (hy[k] + (float)(oy - 1) + v) * 0.5f - v;
+                        float dz = (hz[k] + (float)(oz - 1) + w) * 0.5f - w;
+                        float md = dx * dx + dy * dy + dz * dz;
+                        minDist = md < minDist ? md : minDist;
+                    }
+                }
+                out[x] = sqrtf(minDist);
+            }
+        }
+    }
+
+    free(fx); free(slots);
+    return c;
+}
+
+float* SL_noise2D_perlin_Grid(vec2 origin, vec2 step, uvec2 size, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * size.x * size.y);
+    if (size.x == 0 || size.y == 0) return c;
+
+    int minX, maxX;
+    float* fx = noiseAlloc(size.x * (2 * sizeof(float) + sizeof(int)));
+    float* sx = fx + size.x;
+    int* cx = (int*)(sx + size.x);
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+    for (uint x = 0; x < size.x; x++) sx[x] = fx[x] * fx[x] * (3.0f - 2.0f * fx[x]);
+
+    // Gradients of the rows below and above the samples
+    noise_lattice l = {.x0 = minX, .nx = maxX - minX + 2, .ny = 1, .slotCount = 2, .fill = perlinFill2};
+    float* slots = noiseAlloc(sizeof(float) * 2 * l.nx * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 2 * l.nx * i;
+
+    for (uint y = 0; y < size.y; y++) {
+        const float py = origin.y + step.y * (float)y;
+        const float iy = floor(py);
+        const float v = py - iy, sv = v * v * (3.0f - 2.0f * v);
+        if (y == 0) noiseLatticeInit(&l, (int)iy);
+        else noiseLatticeSlide(&l, (int)iy);
+
+        const float* restrict g0x = l.slots[0], * restrict g0y = g0x + l.nx;
+        const float* restrict g1x = l.slots[1], * restrict g1y = g1x + l.nx;
+        float* restrict out = c + (size_t)size.x * y;
+        for (uint x = 0; x < size.x; x++) {
+            const int i = cx[x];
+            const float u = fx[x];
+
+            float d00 = g0x[i] * u + g0y[i] * v;
+            float d10 = g0x[i + 1] * (u - 1.0f) + g0y[i + 1] * v;
+            float d01 = g1x[i] * u + g1y[i] * (v - 1.0f);
+            float d11 = g1x[i + 1] * (u - 1.0f) + g1y[i + 1] * (v - 1.0f);
+
+            float d0 = d00 + (d10 - d00) * sx[x];
+            float d1 = d01 + (d11 - d01) * sx[x];
+            out[x] = d0 + (d1 - d0) * sv;
+        }
+    }
+
+    free(fx); free(slots);
+    return c;
+}
+float* SL_noise3D_perlin_Grid(vec3 origin, vec3 step, uvec3 size, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * size.x * size.y * size.z);
+    if (size.x == 0 || size.y == 0 || size.z == 0) return c;
+
+    int minX, maxX, minY, maxY;
+    float* fx = noiseAlloc((size.x + size.y) * (2 * sizeof(float) + sizeof(int)));
+    float* fy = fx + size.x, * sx = fy + size.y, * sy = sx + size.x;
+    int* cx = (int*)(sy + size.y), * cy = cx + size.x;
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+    noiseGridAxis(origin.y, step.y, size.y, cy, fy, &minY, &maxY);
+    for (uint x = 0; x < size.x; x++) sx[x] = fx[x] * fx[x] * (3.0f - 2.0f * fx[x]);
+    for (uint y = 0; y < size.y; y++) sy[y] = fy[y] * fy[y] * (3.0f - 2.0f * fy[y]);
+
+    // Gradients of the planes below and above the samples
+    noise_lattice l = {.x0 = minX, .y0 = minY, .nx = maxX - minX + 2, .ny = maxY - minY + 2, .slotCount = 2, .fill = perlinFill3};
+    const uint n = l.nx * l.ny;
+    float* slots = noiseAlloc(sizeof(float) * 3 * n * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 3 * n * i;
+
+    for (uint z = 0; z < size.z; z++) {
+        const float pz = origin.z + step.z * (float)z;
+        const float iz = floor(pz);
+        const float w = pz - iz, sw = w * w * (3.0f - 2.0f * w);
+        if (z == 0) noiseLatticeInit(&l, (int)iz);
+        else noiseLatticeSlide(&l, (int)iz);
+
+        const float* restrict g0 = l.slots[0], * restrict g1 = l.slots[1];
+        #define PERLIN_DOT3(g, k, dx, dy, dz) (g[k] * (dx) + g[(k) + n] * (dy) + g[(k) + 2 * n] * (dz))
+        for (uint y = 0; y < size.y; y++) {
+            const uint r0 = cy[y] * l.nx, r1 = r0 + l.nx;
+            const float v = fy[y], sv = sy[y];
+
+            float* restrict out = c + (size_t)size.x * (y + (size_t)size.y * z);
+            for (uint x = 0; x < size.x; x++) {
+                const int i = cx[x];
+                const float u = fx[x];
+
+                float d000 = PERLIN_DOT3(g0, r0 + i, u, v, w);
+                float d100 = PERLIN_DOT3(g0, r0 + i + 1, u - 1.0f, v, w);
+                float d010 = PERLIN_DOT3(g0, r1 + i, u, v - 1.0f, w);
+                float d110 = PERLIN_DOT3(g0, r1 + i + 1, u - 1.0f, v - 1.0f, w);
+                float d001 = PERLIN_DOT3(g1, r0 + i, u, v, w - 1.0f);
+                float d101 = PERLIN_DOT3(g1, r0 + i + 1, u - 1.0f, v, w - 1.0f);
+                float d011 = PERLIN_DOT3(g1, r1 + i, u, v - 1.0f, w - 1.0f);
+                float d111 = PERLIN_DOT3(g1, r1 + i + 1, u - 1.0f, v - 1.0f, w - 1.0f);
+
+                float d00 = d000 + (d100 - d000) * sx[x];
+                float d10 = d010 + (d110 - d010) * sx[x];
+                float d01 = d001 + (d101 - d001) * sx[x];
+                float d11 = d011 + (d111 - d011) * sx[x];
+
+                float d0 = d00 + (d10 - d00) * sv;
+                float d1 = d01 + (d11 - d01) * sv;
+                out[x] = d0 + (d1 - d0) * sw;
+            }
+        }
+        #undef PERLIN_DOT3
+    }
+
+    free(fx); free(slots);
+    return c;
+}
+
+
+
+///// SIMPLEX
+
+// Skew (F) and unskew (G) factors of the simplex lattices
+#define SIMPLEX_F2 0.36602540f
+#define SIMPLEX_G2 0.21132487f
+#define SIMPLEX_F3 0.33333333f
+#define SIMPLEX_G3 0.16666667f
+#define SIMPLEX_F4 0.30901699f
+#define SIMPLEX_G4 0.13819660f
+
+// Scale bringing each noise to about [-1, 1] (measured maxima of the raw sums)
+#define SIMPLEX_SCALE2 99.0f
+#define SIMPLEX_SCALE3 108.5f
+#define SIMPLEX_SCALE4 108.5f
+
+// Contribution of one corner: (r² - d²)⁴ (g.d), with the kernel radius r² = 0.5
+static inline float simplexCorner2(uint32 h, float x, float y) {
+    float t = 0.5f - x * x - y * y;
+    t = t > 0.0f ? t : 0.0f;
+    t *= t;
+    h &= 15;
+    return t * t * (noiseGrad2[h][0] * x + noiseGrad2[h][1] * y);
+}
+static inline float simplexCorner3(uint32 h, float x, float y, float z) {
+    float t = 0.5f - x * x - y * y - z * z;
+    t = t > 0.0f ? t : 0.0f;
+    t *= t;
+    h &= 15;
+    return t * t * (noiseGrad3[h][0] * x + noiseGrad3[h][1] * y + noiseGrad3[h][2] * z);
+}
+static inline float simplexCorner4(uint32 h, float x, float y, float z, float w) {
+    float t = 0.5f - x * x - y * y - z * z - w * w;
+    t = t > 0.0f ? t : 0.0f;
+    t *= t;
+    h &= 31;
+    return t * t * (noiseGrad4[h][0] * x + noiseGrad4[h][1] * y + noiseGrad4[h][2] * z + noiseGrad4[h][3] * w);
+}
+
+static inline float simplex2(float x, float y) {
+    // Skew to find the cell, unskew to get the offset to its origin
+    const float s = (x + y) * SIMPLEX_F2;
+    const int i = noiseFloor(x + s), j = noiseFloor(y + s);
+    const float t = (float)(i + j) * SIMPLEX_G2;
+    const float x0 = x - ((float)i - t), y0 = y - ((float)j - t);
+
+    // Pick the triangle by comparing the offsets
+    const int i1 = x0 > y0, j1 = 1 - i1;
+
+    return SIMPLEX_SCALE2 * (
+        simplexCorner2(noiseHash2i(i,      j     ), x0,                          y0                         ) +
+        simplexCorner2(noiseHash2i(i + i1, j + j1), x0 - (float)i1 + SIMPLEX_G2, y0 - (float)j1 + SIMPLEX_G2) +
+        simplexCorner2(noiseHash2i(i + 1,  j + 1 ), x0 - 1.0f + 2.0f * SIMPLEX_G2, y0 - 1.0f + 2.0f * SIMPLEX_G2)
+    );
+}
+static inline float simplex3(float x, float y, float z) {
+    const float s = (x + y + z) * SIMPLEX_F3;
+    const int i = noiseFloor(x + s), j = noiseFloor(y + s), k = noiseFloor(z + s);
+    const float t = (float)(i + j + k) * SIMPLEX_G3;
+    const float x0 = x - ((float)i - t), y0 = y - ((float)j - t), z0 = z - ((float)k - t);
+
+    // Rank the offsets: the simplex walks the axes from the largest to the smallest
+    const int rx = (x0 > y0) + (x0 > z0), ry = (x0 <= y0) + (y0 > z0), rz = (x0 <= z0) + (y0 <= z0);
+    const int i1 = rx >= 2, j1 = ry >= 2, k1 = rz >= 2;
+    const int i2 = rx >= 1, j2 = ry >= 1, k2 = rz >= 1;
+
+    return SIMPLEX_SCALE3 * (
+        simplexCorner3(noiseHash3i(i,      j,      k     ), x0, y0, z0) +
+        simplexCorner3(noiseHash3i(i + i1, j + j1, k + k1), x0 - (float)i1 + SIMPLEX_G3, y0 - (float)j1 + SIMPLEX_G3, z0 - (float)k1 + SIMPLEX_G3) +
+        simplexCorner3(noiseHash3i(i + i2, j + j2, k + k2), x0 - (float)i2 + 2.0f * SIMPLEX_G3, y0 - (float)j2 + 2.0f * SIMPLEX_G3, z0 - (float)k2 + 2.0f * SIMPLEX_G3) +
+        simplexCorner3(noiseHash3i(i + 1,  j + 1,  k + 1 ), x0 - 1.0f + 3.0f * SIMPLEX_G3, y0 - 1.0f + 3.0f * SIMPLEX_G3, z0 - 1.0f + 3.0f * SIMPLEX_G3)
+    );
+}
+static inline float simplex4(float x, float y, float z, float w) {
+    const float s = (x + y + z + w) * SIMPLEX_F4;
+    const int i = noiseFloor(x + s), j = noiseFloor(y + s), k = noiseFloor(z + s), l = noiseFloor(w + s);
+    const float t = (float)(i + j + k + l) * SIMPLEX_G4;
+    const float x0 = x - ((float)i - t), y0 = y - ((float)j - t), z0 = z - ((float)k - t), w0 = w - ((float)l - t);
+
+    const int rx = (x0 > y0) + (x0 > z0) + (x0 > w0);
+    const int ry = (x0 <= y0) + (y0 > z0) + (y0 > w0);
+    const int rz = (x0 <= z0) + (y0 <= z0) + (z0 > w0);
+    const int rw = (x0 <= w0) + (y0 <= w0) + (z0 <= w0);
+    const int i1 = rx >= 3, j1 = ry >= 3, k1 = rz >= 3, l1 = rw >= 3;
+    const int i2 = rx >= 2, j2 = ry >= 2, k2 = rz >= 2, l2 = rw >= 2;
+    const int i3 = rx >= 1, j3 = ry >= 1, k3 = rz >= 1, l3 = rw >= 1;
+
+    return SIMPLEX_SCALE4 * (
+        simplexCorner4(noiseHash4i(i,      j,      k,      l     ), x0, y0, z0, w0) +
+        simplexCorner4(noiseHash4i(i + i1, j + j1, k + k1, l + l1), x0 - (float)i1 + SIMPLEX_G4, y0 - (float)j1 + SIMPLEX_G4, z0 - (float)k1 + SIMPLEX_G4, w0 - (float)l1 + SIMPLEX_G4) +
+        simplexCorner4(noiseHash4i(i + i2, j + j2, k + k2, l + l2), x0 - (float)i2 + 2.0f * SIMPLEX_G4, y0 - (float)j2 + 2.0f * SIMPLEX_G4, z0 - (float)k2 + 2.0f * SIMPLEX_G4, w0 - (float)l2 + 2.0f * SIMPLEX_G4) +
+        simplexCorner4(noiseHash4i(i + i3, j + j3, k + k3, l + l3), x0 - (float)i3 + 3.0f * SIMPLEX_G4, y0 - (float)j3 + 3.0f * SIMPLEX_G4, z0 - (float)k3 + 3.0f * SIMPLEX_G4, w0 - (float)l3 + 3.0f * SIMPLEX_G4) +
+        simplexCorner4(noiseHash4i(i + 1,  j + 1,  k + 1,  l + 1 ), x0 - 1.0f + 4.0f * SIMPLEX_G4, y0 - 1.0f + 4.0f * SIMPLEX_G4, z0 - 1.0f + 4.0f * SIMPLEX_G4, w0 - 1.0f + 4.0f * SIMPLEX_G4)
+    );
+}
+
+float SL_noise2D_simplex(vec2 p) {
+    return simplex2(p.x, p.y);
+}
+float SL_noise3D_simplex(vec3 p) {
+    return simplex3(p.x, p.y, p.z);
+}
+float SL_noise4D_simplex(vec4 p) {
+    return simplex4(p.x, p.y, p.z, p.w);
+}
+
+// Number of positions gathered into SoA lanes before each evaluation pass
+#define NOISE_BATCH_BLOCK 64
+
+float* SL_noise2D_simplex_Batch(const vec2* p, uint count, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint n = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < n; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; }
+
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = simplex2(x[i], y[i]);
+    }
+    return c;
+}
+float* SL_noise3D_simplex_Batch(const vec3* p, uint count, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK], z[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint n = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < n; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; z[i] = p[start + i].z; }
+
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = simplex3(x[i], y[i], z[i]);
+    }
+    return c;
+}
+float* SL_noise4D_simplex_Batch(const vec4* p, uint count, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK], z[NOISE_BATCH_BLOCK], w[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint n = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < n; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; z[i] = p[start + i].z; w[i] = p[start + i].w; }
+
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = simplex4(x[i], y[i], z[i], w[i]);
+    }
+    return c;
+}
+
+float* SL_noise2D_perlin_Batch(const vec2* p, uint count, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint n = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < n; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; }
+
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = perlin2(x[i], y[i]);
+    }
+    return c;
+}
+float* SL_noise3D_perlin_Batch(const vec3* p, uint count, float* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(float) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK], z[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint n = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < n; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; z[i] = p[start + i].z; }
+
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = perlin3(x[i], y[i], z[i]);
+    }
+    return c;
+}
+
+
+
+///// DERIVATIVES
+
+// Same operations as perlin2 for the value, plus the derivatives of the dot products and of the fade curves
+static inline float perlinDeriv2(float x, float y, float* restrict dx, float* restrict dy) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y);
+    const float u = x - (float)ix, v = y - (float)iy;
+    const float su = u * u * (3.0f - 2.0f * u), sv = v * v * (3.0f - 2.0f * v);
+    const float dsu = 6.0f * u * (1.0f - u), dsv = 6.0f * v * (1.0f - v);
+
+    const uint32 h00 = noiseHash2i(ix, iy) & 15, h10 = noiseHash2i(ix + 1, iy) & 15;
+    const uint32 h01 = noiseHash2i(ix, iy + 1) & 15, h11 = noiseHash2i(ix + 1, iy + 1) & 15;
+    const float d00 = noiseGrad2[h00][0] * u          + noiseGrad2[h00][1] * v;
+    const float d10 = noiseGrad2[h10][0] * (u - 1.0f) + noiseGrad2[h10][1] * v;
+    const float d01 = noiseGrad2[h01][0] * u          + noiseGrad2[h01][1] * (v - 1.0f);
+    const float d11 = noiseGrad2[h11][0] * (u - 1.0f) + noiseGrad2[h11][1] * (v - 1.0f);
+
+    const float d0 = d00 + (d10 - d00) * su;
+    const float d1 = d01 + (d11 - d01) * su;
+
+    // Gradients of the corners lerped like the values, plus the slope of each fade curve
+    const float gx0 = noiseGrad2[h00][0] + (noiseGrad2[h10][0] - noiseGrad2[h00][0]) * su;
+    const float gx1 = noiseGrad2[h01][0] + (noiseGrad2[h11][0] - noiseGrad2[h01][0]) * su;
+    const float gy0 = noiseGrad2[h00][1] + (noiseGrad2[h10][1] - noiseGrad2[h00][1]) * su;
+    const float gy1 = noiseGrad2[h01][1] + (noiseGrad2[h11][1] - noiseGrad2[h01][1]) * su;
+    const float ex0 = d10 - d00, ex1 = d11 - d01;
+    *dx = gx0 + (gx1 - gx0) * sv + (ex0 + (ex1 - ex0) * sv) * dsu;
+    *dy = gy0 + (gy1 - gy0) * sv + (d1 - d0) * dsv;
+
+    return d0 + (d1 - d0) * sv;
+}
+static inline float perlinTrilerp(float c000, float c100, float c010, float c110, float c001, float c101, float c011, float c111, float su, float sv, float sw) {
+    const float c00 = c000 + (c100 - c000) * su, c10 = c010 + (c110 - c010) * su;
+    const float c01 = c001 + (c101 - c001) * su, c11 = c011 + (c111 - c011) * su;
+    const float c0 = c00 + (c10 - c00) * sv, c1 = c01 + (c11 - c01) * sv;
+    return c0 + (c1 - c0) * sw;
+}
+static ALWAYS_INLINE float perlinDeriv3(float x, float y, float z, float* restrict dx, float* restrict dy, float* restrict dz) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z);
+    const float u = x - (float)ix, v = y - (float)iy, w = z - (float)iz;
+    const float su = u * u * (3.0f - 2.0f * u), sv = v * v * (3.0f - 2.0f * v), sw = w * w * (3.0f - 2.0f * w);
+    const float dsu = 6.0f * u * (1.0f - u), dsv = 6.0f * v * (1.0f - v), dsw = 6.0f * w * (1.0f - w);
+
+    const uint32 h000 = noiseHash3i(ix, iy,     iz    ) & 15, h100 = noiseHash3i(ix + 1, iy,     iz    ) & 15;
+    const uint32 h010 = noiseHash3i(ix, iy + 1, iz    ) & 15, h110 = noiseHash3i(ix + 1, iy + 1, iz    ) & 15;
+    const uint32 h001 = noiseHash3i(ix, iy,     iz + 1) & 15, h101 = noiseHash3i(ix + 1, iy,     iz + 1) & 15;
+    const uint32 h011 = noiseHash3i(ix, iy + 1, iz + 1) & 15, h111 = noiseHash3i(ix + 1, iy + 1, iz + 1) & 15;
+    #define PERLIN_DOT3(h, a, b, c) (noiseGrad3[h][0] * (a) + noiseGrad3[h][1] * (b) + noiseGrad3[h][2] * (c))
+    const float d000 = PERLIN_DOT3(h000, u,        v,        w       );
+    const float d100 = PERLIN_DOT3(h100, u - 1.0f, v,        w       );
+    const float d010 = PERLIN_DOT3(h010, u,        v - 1.0f, w       );
+    const float d110 = PERLIN_DOT3(h110, u - 1.0f, v - 1.0f, w       );
+    const float d001 = PERLIN_DOT3(h001, u,        v,        w - 1.0f);
+    const float d101 = PERLIN_DOT3(h101, u - 1.0f, v,        w - 1.0f);
+    const float d011 = PERLIN_DOT3(h011, u,        v - 1.0f, w - 1.0f);
+    const float d111 = PERLIN_DOT3(h111, u - 1.0f, v - 1.0f, w - 1.0f);
+    #undef PERLIN_DOT3
+
+    const float d00 = d000 + (d100 - d000) * su;
+    const float d10 = d010 + (d110 - d010) * su;
+    const float d01 = d001 + (d101 - d001) * su;
+    const float d11 = d011 + (d111 - d011) * su;
+    const float d0 = d00 + (d10 - d00) * sv;
+    const float d1 = d01 + (d11 - d01) * sv;
+
+    // Gradients of the corners lerped like the values, one axis at a time
+    #define PERLIN_GRAD3(a) perlinTrilerp(noiseGrad3[h000][a], noiseGrad3[h100][a], noiseGrad3[h010][a], noiseGrad3[h110][a], \
+                                          noiseGrad3[h001][a], noiseGrad3[h101][a], noiseGrad3[h011][a], noiseGrad3[h111][a], su, sv, sw)
+    const float gx = PERLIN_GRAD3(0), gy = PERLIN_GRAD3(1), gz = PERLIN_GRAD3(2);
+    #undef PERLIN_GRAD3
+
+    // Slope of each fade curve times the difference it lerps across
+    const float ex00 = d100 - d000, ex10 = d110 - d010, ex01 = d101 - d001, ex11 = d111 - d011;
+    const float ex0 = ex00 + (ex10 - ex00) * sv, ex1 = ex01 + (ex11 - ex01) * sv;
+    const float ey0 = d10 - d00, ey1 = d11 - d01;
+    *dx = gx + (ex0 + (ex1 - ex0) * sw) * dsu;
+    *dy = gy + (ey0 + (ey1 - ey0) * sw) * dsv;
+    *dz = gz + (d1 - d0) * dsw;
+
+    return d0 + (d1 - d0) * sw;
+}
+
+// Same contribution as simplexCorner2 / simplexCorner3, adding its gradient t⁴ g - 8 t³ (g.d) d to the accumulators
+static inline float simplexCornerDeriv2(uint32 h, float x, float y, float* restrict dx, float* restrict dy) {
+    float t = 0.5f - x * x - y * y;
+    t = t > 0.0f ? t : 0.0f;
+    const float t2 = t * t, t4 = t2 * t2;
+    h &= 15;
+    const float gd = noiseGrad2[h][0] * x + noiseGrad2[h][1] * y;
+    const float k = 8.0f * t2 * t * gd;
+    *dx += t4 * noiseGrad2[h][0] - k * x;
+    *dy += t4 * noiseGrad2[h][1] - k * y;
+    return t4 * gd;
+}
+static inline float simplexCornerDeriv3(uint32 h, float x, float y, float z, float* restrict dx, float* restrict dy, float* restrict dz) {
+    float t = 0.5f - x * x - y * y - z * z;
+    t = t > 0.0f ? t : 0.0f;
+    const float t2 = t * t, t4 = t2 * t2;
+    h &= 15;
+    const float gd = noiseGrad3[h][0] * x + noiseGrad3[h][1] * y + noiseGrad3[h][2] * z;
+    const float k = 8.0f * t2 * t * gd;
+    *dx += t4 * noiseGrad3[h][0] - k * x;
+    *dy += t4 * noiseGrad3[h][1] - k * y;
+    *dz += t4 * noiseGrad3[h][2] - k * z;
+    return t4 * gd;
+}
+
+// The corner offsets are the position minus constants, so their derivative is the identity
+static inline float simplexDeriv2(float x, float y, float* restrict dx, float* restrict dy) {
+    const float s = (x + y) * SIMPLEX_F2;
+    const int i = noiseFloor(x + s), j = noiseFloor(y + s);
+    const float t = (float)(i + j) * SIMPLEX_G2;
+    const float x0 = x - ((float)i - t), y0 = y - ((float)j - t);
+    const int i1 = x0 > y0, j1 = 1 - i1;
+
+    float gx = 0.0f, gy = 0.0f;
+    const float n =
+        simplexCornerDeriv2(noiseHash2i(i,      j     ), x0,                          y0,                          &gx, &gy) +
+        simplexCornerDeriv2(noiseHash2i(i + i1, j + j1), x0 - (float)i1 + SIMPLEX_G2, y0 - (float)j1 + SIMPLEX_G2, &gx, &gy) +
+        simplexCornerDeriv2(noiseHash2i(i + 1,  j + 1 ), x0 - 1.0f + 2.0f * SIMPLEX_G2, y0 - 1.0f + 2.0f * SIMPLEX_G2, &gx, &gy);
+    *dx = SIMPLEX_SCALE2 * gx;
+    *dy = SIMPLEX_SCALE2 * gy;
+    return SIMPLEX_SCALE2 * n;
+}
+static inline float simplexDeriv3(float x, float y, float z, float* restrict dx, float* restrict dy, float* restrict dz) {
+    const float s = (x + y + z) * SIMPLEX_F3;
+    const int i = noiseFloor(x + s), j = noiseFloor(y + s), k = noiseFloor(z + s);
+    const float t = (float)(i + j + k) * SIMPLEX_G3;
+    const float x0 = x - ((float)i - t), y0 = y - ((float)j - t), z0 = z - ((float)k - t);
+
+    const int rx = (x0 > y0) + (x0 > z0), ry = (x0 <= y0) + (y0 > z0), rz = (x0 <= z0) + (y0 <= z0);
+    const int i1 = rx >= 2, j1 = ry >= 2, k1 = rz >= 2;
+    const int i2 = rx >= 1, j2 = ry >= 1, k2 = rz >= 1;
+
+    float gx = 0.0f, gy = 0.0f, gz = 0.0f;
+    const float n =
+        simplexCornerDeriv3(noiseHash3i(i,      j,      k     ), x0, y0, z0, &gx, &gy, &gz) +
+        simplexCornerDeriv3(noiseHash3i(i + i1, j + j1, k + k1), x0 - (float)i1 + SIMPLEX_G3, y0 - (float)j1 + SIMPLEX_G3, z0 - (float)k1 + SIMPLEX_G3, &gx, &gy, &gz) +
+        simplexCornerDeriv3(noiseHash3i(i + i2, j + j2, k + k2), x0 - (float)i2 + 2.0f * SIMPLEX_G3, y0 - (float)j2 + 2.0f * SIMPLEX_G3, z0 - (float)k2 + 2.0f * SIMPLEX_G3, &gx, &gy, &gz) +
+        simplexCornerDeriv3(noiseHash3i(i + 1,  j + 1,  k + 1 ), x0 - 1.0f + 3.0f * SIMPLEX_G3, y0 - 1.0f + 3.0f * SIMPLEX_G3, z0 - 1.0f + 3.0f * SIMPLEX_G3, &gx, &gy, &gz);
+    *dx = SIMPLEX_SCALE3 * gx;
+    *dy = SIMPLEX_SCALE3 * gy;
+    *dz = SIMPLEX_SCALE3 * gz;
+    return SIMPLEX_SCALE3 * n;
+}
+
+vec3 SL_noise2D_perlin_Deriv(vec2 p) {
+    vec3 r;
+    r.x = perlinDeriv2(p.x, p.y, &r.y, &r.z);
+    return r;
+}
+vec4 SL_noise3D_perlin_Deriv(vec3 p) {
+    vec4 r;
+    r.x = perlinDeriv3(p.x, p.y, p.z, &r.y, &r.z, &r.w);
+    return r;
+}
+vec3 SL_noise2D_simplex_Deriv(vec2 p) {
+    vec3 r;
+    r.x = simplexDeriv2(p.x, p.y, &r.y, &r.z);
+    return r;
+}
+vec4 SL_noise3D_simplex_Deriv(vec3 p) {
+    vec4 r;
+    r.x = simplexDeriv3(p.x, p.y, p.z, &r.y, &r.z, &r.w);
+    return r;
+}
+
+vec3* SL_noise2D_perlin_Deriv_Batch(const vec2* p, uint count, vec3* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(vec3) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK];
+    float n[NOISE_BATCH_BLOCK], dx[NOISE_BATCH_BLOCK], dy[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; }
+        for (uint i = 0; i < size; i++) n[i] = perlinDeriv2(x[i], y[i], dx + i, dy + i);
+
+        vec3* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = Vec3(n[i], dx[i], dy[i]);
+    }
+    return c;
+}
+vec4* SL_noise3D_perlin_Deriv_Batch(const vec3* p, uint count, vec4* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(vec4) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK], z[NOISE_BATCH_BLOCK];
+    float n[NOISE_BATCH_BLOCK], dx[NOISE_BATCH_BLOCK], dy[NOISE_BATCH_BLOCK], dz[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; z[i] = p[start + i].z; }
+        for (uint i = 0; i < size; i++) n[i] = perlinDeriv3(x[i], y[i], z[i], dx + i, dy + i, dz + i);
+
+        vec4* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = Vec4(n[i], dx[i], dy[i], dz[i]);
+    }
+    return c;
+}
+vec3* SL_noise2D_simplex_Deriv_Batch(const vec2* p, uint count, vec3* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(vec3) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK];
+    float n[NOISE_BATCH_BLOCK], dx[NOISE_BATCH_BLOCK], dy[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; }
+        for (uint i = 0; i < size; i++) n[i] = simplexDeriv2(x[i], y[i], dx + i, dy + i);
+
+        vec3* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = Vec3(n[i], dx[i], dy[i]);
+    }
+    return c;
+}
+vec4* SL_noise3D_simplex_Deriv_Batch(const vec3* p, uint count, vec4* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(vec4) * count);
+    float x[NOISE_BATCH_BLOCK], y[NOISE_BATCH_BLOCK], z[NOISE_BATCH_BLOCK];
+    float n[NOISE_BATCH_BLOCK], dx[NOISE_BATCH_BLOCK], dy[NOISE_BATCH_BLOCK], dz[NOISE_BATCH_BLOCK];
+
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) { x[i] = p[start + i].x; y[i] = p[start + i].y; z[i] = p[start + i].z; }
+        for (uint i = 0; i < size; i++) n[i] = simplexDeriv3(x[i], y[i], z[i], dx + i, dy + i, dz + i);
+
+        vec4* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = Vec4(n[i], dx[i], dy[i], dz[i]);
+    }
+    return c;
+}
+
+
+
+///// WORLEY
+
+// Keep the two smallest distances and the cell of the smallest one, without branches
+#define WORLEY_INSERT(f1, f2, id, d, cell) { \
+    f2 = f2 < (d > f1 ? d : f1) ? f2 : (d > f1 ? d : f1); \
+    id = d < f1 ? cell : id; \
+    f1 = d < f1 ? d : f1; \
+}
+
+// Offsets of the candidate cells, x fastest
+static const int worleyOffsetX[27] = {-1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1, -1, 0, 1};
+static const int worleyOffsetY[27] = {-1, -1, -1, 0, 0, 0, 1, 1, 1, -1, -1, -1, 0, 0, 0, 1, 1, 1, -1, -1, -1, 0, 0, 0, 1, 1, 1};
+static const int worleyOffsetZ[27] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+
+static inline worley_sample worley2(float x, float y) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y);
+    const float u = x - (float)ix, v = y - (float)iy;
+
+    // The 9 candidates in lanes
+    float d[9];
+    uint32 cell[9];
+    for (int k = 0; k < 9; k++) {
+        const int ox = worleyOffsetX[k], oy = worleyOffsetY[k];
+        const uint32 h = noiseHash2i(ix + ox, iy + oy);
+        const float dx = noiseHashToFloat(h) + (float)ox - u;
+        const float dy = noiseHashToFloat(SL_PCGHash(h)) + (float)oy - v;
+        d[k] = dx * dx + dy * dy;
+        cell[k] = h;
+    }
+
+    float f1 = 8.0f, f2 = 8.0f;
+    uint32 id = 0;
+    for (int k = 0; k < 9; k++) WORLEY_INSERT(f1, f2, id, d[k], cell[k]);
+    return (worley_sample) {sqrtf(f1), sqrtf(f2), id};
+}
+static inline worley_sample worley3(float x, float y, float z) {
+    const int ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z);
+    const float u = x - (float)ix, v = y - (float)iy, w = z - (float)iz;
+
+    // The 27 candidates in lanes
+    float d[27];
+    uint32 cell[27];
+    for (int k = 0; k < 27; k++) {
+        const int ox = worleyOffsetX[k], oy = worleyOffsetY[k], oz = worleyOffsetZ[k];
+        const uint32 h1 = noiseHash3i(ix + ox, iy + oy, iz + oz), h2 = SL_PCGHash(h1);
+        const float dx = noiseHashToFloat(h1) + (float)ox - u;
+        const float dy = noiseHashToFloat(h2) + (float)oy - v;
+        const float dz = noiseHashToFloat(SL_PCGHash(h2)) + (float)oz - w;
+        d[k] = dx * dx + dy * dy + dz * dz;
+        cell[k] = h1;
+    }
+
+    float f1 = 12.0f, f2 = 12.0f;
+    uint32 id = 0;
+    for (int k = 0; k < 27; k++) WORLEY_INSERT(f1, f2, id, d[k], cell[k]);
+    return (worley_sample) {sqrtf(f1), sqrtf(f2), id};
+}
+
+worley_sample SL_noise2D_worley(vec2 p) {
+    return worley2(p.x, p.y);
+}
+worley_sample SL_noise3D_worley(vec3 p) {
+    return worley3(p.x, p.y, p.z);
+}
+
+// The batches go through the candidates one at a time, each one for the whole block of samples, so the
+// inner loops run the same operations as worley2 / worley3 on every lane and are vectorized across samples
+worley_sample* SL_noise2D_worley_Batch(const vec2* p, uint count, worley_sample* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(worley_sample) * count);
+
+    int ix[NOISE_BATCH_BLOCK], iy[NOISE_BATCH_BLOCK];
+    float u[NOISE_BATCH_BLOCK], v[NOISE_BATCH_BLOCK];
+    float f1[NOISE_BATCH_BLOCK], f2[NOISE_BATCH_BLOCK];
+    uint32 id[NOISE_BATCH_BLOCK];
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) {
+            const float x = p[start + i].x, y = p[start + i].y;
+            ix[i] = noiseFloor(x); iy[i] = noiseFloor(y);
+            u[i] = x - (float)ix[i]; v[i] = y - (float)iy[i];
+            f1[i] = 8.0f; f2[i] = 8.0f; id[i] = 0;
+        }
+
+        for (int k = 0; k < 9; k++) {
+            const int ox = worleyOffsetX[k], oy = worleyOffsetY[k];
+            for (uint i = 0; i < size; i++) {
+                const uint32 h = noiseHash2i(ix[i] + ox, iy[i] + oy);
+                const float dx = noiseHashToFloat(h) + (float)ox - u[i];
+                const float dy = noiseHashToFloat(SL_PCGHash(h)) + (float)oy - v[i];
+                const float d = dx * dx + dy * dy;
+                WORLEY_INSERT(f1[i], f2[i], id[i], d, h);
+            }
+        }
+
+        worley_sample* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = (worley_sample) {sqrtf(f1[i]), sqrtf(f2[i]), id[i]};
+    }
+    return c;
+}
+worley_sample* SL_noise3D_worley_Batch(const vec3* p, uint count, worley_sample* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(worley_sample) * count);
+
+    int ix[NOISE_BATCH_BLOCK], iy[NOISE_BATCH_BLOCK], iz[NOISE_BATCH_BLOCK];
+    float u[NOISE_BATCH_BLOCK], v[NOISE_BATCH_BLOCK], w[NOISE_BATCH_BLOCK];
+    float f1[NOISE_BATCH_BLOCK], f2[NOISE_BATCH_BLOCK];
+    uint32 id[NOISE_BATCH_BLOCK];
+    for (uint start = 0; start < count; start += NOISE_BATCH_BLOCK) {
+        const uint size = count - start < NOISE_BATCH_BLOCK ? count - start : NOISE_BATCH_BLOCK;
+        for (uint i = 0; i < size; i++) {
+            const float x = p[start + i].x, y = p[start + i].y, z = p[start + i].z;
+            ix[i] = noiseFloor(x); iy[i] = noiseFloor(y); iz[i] = noiseFloor(z);
+            u[i] = x - (float)ix[i]; v[i] = y - (float)iy[i]; w[i] = z - (float)iz[i];
+            f1[i] = 12.0f; f2[i] = 12.0f; id[i] = 0;
+        }
+
+        for (int k = 0; k < 27; k++) {
+            const int ox = worleyOffsetX[k], oy = worleyOffsetY[k], oz = worleyOffsetZ[k];
+            for (uint i = 0; i < size; i++) {
+                const uint32 h1 = noiseHash3i(ix[i] + ox, iy[i] + oy, iz[i] + oz), h2 = SL_PCGHash(h1);
+                const float dx = noiseHashToFloat(h1) + (float)ox - u[i];
+                const float dy = noiseHashToFloat(h2) + (float)oy - v[i];
+                const float dz = noiseHashToFloat(SL_PCGHash(h2)) + (float)oz - w[i];
+                const float d = dx * dx + dy * dy + dz * dz;
+                WORLEY_INSERT(f1[i], f2[i], id[i], d, h1);
+            }
+        }
+
+        worley_sample* restrict out = c + start;
+        for (uint i = 0; i < size; i++) out[i] = (worley_sample) {sqrtf(f1[i]), sqrtf(f2[i]), id[i]};
+    }
+    return c;
+}
+
+// Feature points and cell ids: x, y (and z) coordinates, then ids stored as uint32
+static void worleyFill2(float* h, int y, const noise_lattice* l) {
+    uint32* id = (uint32*)(h + 2 * l->nx);
+    for (uint i = 0; i < l->nx; i++) {
+        const uint32 k = noiseHash2i(l->x0 + (int)i, y);
+        h[i] = noiseHashToFloat(k);
+        h[i + l->nx] = noiseHashToFloat(SL_PCGHash(k));
+        id[i] = k;
+    }
+}
+static void worleyFill3(float* h, int z, const noise_lattice* l) {
+    const uint n = l->nx * l->ny;
+    uint32* id = (uint32*)(h + 3 * n);
+    for (uint j = 0; j < l->ny; j++)
+    for (uint i = 0; i < l->nx; i++) {
+        const uint32 h1 = noiseHash3i(l->x0 + (int)i, l->y0 + (int)j, z), h2 = SL_PCGHash(h1);
+        const uint k = i + l->nx * j;
+        h[k] = noiseHashToFloat(h1);
+        h[k + n] = noiseHashToFloat(h2);
+        h[k + 2 * n] = noiseHashToFloat(SL_PCGHash(h2));
+        id[k] = h1;
+    }
+}
+
+worley_sample* SL_noise2D_worley_Grid(vec2 origin, vec2 step, uvec2 size, worley_sample* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(worley_sample) * size.x * size.y);
+    if (size.x == 0 || size.y == 0) return c;
+
+    int minX, maxX;
+    float* fx = noiseAlloc(size.x * (sizeof(float) + sizeof(int)));
+    int* cx = (int*)(fx + size.x);
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+
+    // Rows above, at and below the samples, one cell wider on each side
+    noise_lattice l = {.x0 = minX - 1, .nx = maxX - minX + 3, .ny = 1, .slotCount = 3, .fill = worleyFill2};
+    float* slots = noiseAlloc(sizeof(float) * 3 * l.nx * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 3 * l.nx * i;
+
+    for (uint y = 0; y < size.y; y++) {
+        const float py = origin.y + step.y * (float)y;
+        const float iy = floor(py);
+        const float v = py - iy;
+        if (y == 0) noiseLatticeInit(&l, (int)iy - 1);
+        else noiseLatticeSlide(&l, (int)iy - 1);
+
+        worley_sample* restrict out = c + (size_t)size.x * y;
+        for (uint x = 0; x < size.x; x++) {
+            const int i = cx[x];
+            const float u = fx[x];
+
+            // Same operations and candidate order as SL_noise2D_worley
+            float f1 = 8.0f, f2 = 8.0f;
+            uint32 id = 0;
+            for (int oy = 0; oy < 3; oy++) {
+                const float* restrict hx = l.slots[oy], * restrict hy = hx + l.nx;
+                const uint32* restrict cell = (const uint32*)(hy + l.nx);
+                for (int ox = 0; ox < 3; ox++) {
+                    const float dx = hx[i + ox] + (float)(ox - 1) - u;
+                    const float dy = hy[i + ox] + (float)(oy - 1) - v;
+                    const float d = dx * dx + dy * dy;
+                    WORLEY_INSERT(f1, f2, id, d, cell[i + ox]);
+                }
+            }
+            out[x] = (worley_sample) {sqrtf(f1), sqrtf(f2), id};
+        }
+    }
+
+    free(fx); free(slots);
+    return c;
+}
+worley_sample* SL_noise3D_worley_Grid(vec3 origin, vec3 step, uvec3 size, worley_sample* restrict c) {
+    if (!c) c = noiseAlloc(sizeof(worley_sample) * size.x * size.y * size.z);
+    if (size.x == 0 || size.y == 0 || size.z == 0) return c;
+
+    int minX, maxX, minY, maxY;
+    float* fx = noiseAlloc((size.x + size.y) * (sizeof(float) + sizeof(int)));
+    float* fy = fx + size.x;
+    int* cx = (int*)(fy + size.y), * cy = cx + size.x;
+    noiseGridAxis(origin.x, step.x, size.x, cx, fx, &minX, &maxX);
+    noiseGridAxis(origin.y, step.y, size.y, cy, fy, &minY, &maxY);
+
+    // Planes above, at and below the samples, one cell wider on each side
+    noise_lattice l = {.x0 = minX - 1, .y0 = minY - 1, .nx = maxX - minX + 3, .ny = maxY - minY + 3, .slotCount = 3, .fill = worleyFill3};
+    const uint n = l.nx * l.ny;
+    float* slots = noiseAlloc(sizeof(float) * 4 * n * l.slotCount);
+    for (uint i = 0; i < l.slotCount; i++) l.slots[i] = slots + 4 * n * i;
+
+    for (uint z = 0; z < size.z; z++) {
+        const float pz = origin.z + step.z * (float)z;
+        const float iz = floor(pz);
+        const float w = pz - iz;
+        if (z == 0) noiseLatticeInit(&l, (int)iz - 1);
+        else noiseLatticeSlide(&l, (int)iz - 1);
+
+        for (uint y = 0; y < size.y; y++) {
+            const int j = cy[y];
+            const float v = fy[y];
+
+            worley_sample* restrict out = c + (size_t)size.x * (y + (size_t)size.y * z);
+            for (uint x = 0; x < size.x; x++) {
+                const int i = cx[x];
+                const float u = fx[x];
+
+                // Same operations and candidate order as SL_noise3D_worley
+                float f1 = 12.0f, f2 = 12.0f;
+                uint32 id = 0;
+                for (int oz = 0; oz < 3; oz++) {
+                    const float* restrict hx = l.slots[oz], * restrict hy = hx + n, * restrict hz = hy + n;
+                    const uint32* restrict cell = (const uint32*)(hz + n);
+                    for (int oy = 0; oy < 3; oy++)
+                    for (int ox = 0; ox < 3; ox++) {
+                        const uint k = (j + oy) * l.nx + i + ox;
+                        const float dx = hx[k] + (float)(ox - 1) - u;
+                        const float dy = hy[k] + (float)(oy - 1) - v;
+                        const float dz = hz[k] + (float)(oz - 1) - w;
+                        const float d = dx * dx + dy * dy + dz * dz;
+                        WORLEY_INSERT(f1, f2, id, d, cell[k]);
+                    }
+                }
+                out[x] = (worley_sample) {sqrtf(f1), sqrtf(f2), id};
+            }
+        }
+    }
+
+    free(fx); free(slots);
+    return c;
+}
\ No newline at end of file
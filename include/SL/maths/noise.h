@@ -0,0 +1,269 @@
+#ifndef __SL_MATHS_NOISE_H__
+#define __SL_MATHS_NOISE_H__
+
+#include "../structures.h"
+#include "math.h"
+#include "vector.h"
+
+// All hashes and noises only use integer hashing (PCG Hash) and basic float arithmetic, so they give
+// bit-exact results on every machine as long as the library is built without FMA contraction (-ffp-contract=off)
+
+/// @brief Hash a 2D position to a float
+/// @param p The position
+/// @return A pseudo-random float in [0, 1[
+float hash21(vec2 p);
+/// @brief Hash a 3D position to a float
+/// @param p The position
+/// @return A pseudo-random float in [0, 1[
+float hash31(vec3 p);
+
+/// @brief Hash a 2D position to a 2D vector
+/// @param v The position
+/// @return A pseudo-random vector in [0, 1[²
+vec2 hash22(vec2 v);
+/// @brief Hash a 3D position to a 3D vector
+/// @param v The position
+/// @return A pseudo-random vector in [0, 1[³
+vec3 hash33(vec3 v);
+
+/// @brief Hash a 2D position to a 2D unit vector
+/// @param v The position
+/// @return A pseudo-random unit vector
+vec2 hash2Unit2(vec2 v);
+/// @brief Hash a 3D position to a 3D unit vector
+/// @param v The position
+/// @return A pseudo-random unit vector
+vec3 hash3Unit3(vec3 v);
+
+/// @brief Voronoi noise in 2D
+/// @param p The position
+/// @return The noise value
+float SL_noise2D_voronoi(vec2 p);
+/// @brief Voronoi noise in 3D
+/// @param p The position
+/// @return The noise value
+float SL_noise3D_voronoi(vec3 p);
+
+/// @brief Perlin noise in 2D
+/// @param p The position
+/// @return The noise value
+float SL_noise2D_perlin(vec2 p);
+/// @brief Perlin noise in 3D
+/// @param p The position
+/// @return The noise value
+float SL_noise3D_perlin(vec3 p);
+
+/// @brief Perlin noise in 2D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_perlin, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+float* SL_noise2D_perlin_Batch(const vec2* p, uint count, float* restrict destination);
+/// @brief Perlin noise in 3D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_perlin, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+float* SL_noise3D_perlin_Batch(const vec3* p, uint count, float* restrict destination);
+
+/// @brief Simplex noise in 2D
+/// @param p The position
+/// @return The noise value (about [-1, 1])
+/// @note Sums 3 corners instead of Perlin's 4, without axis-aligned artifacts
+float SL_noise2D_simplex(vec2 p);
+/// @brief Simplex noise in 3D
+/// @param p The position
+/// @return The noise value (about [-1, 1])
+/// @note Sums 4 corners instead of Perlin's 8
+float SL_noise3D_simplex(vec3 p);
+/// @brief Simplex noise in 4D
+/// @param p The position
+/// @return The noise value (about [-1, 1])
+/// @note Sums 5 corners, use w as time to animate a 3D field
+float SL_noise4D_simplex(vec4 p);
+
+/// @brief Simplex noise in 2D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_simplex, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+float* SL_noise2D_simplex_Batch(const vec2* p, uint count, float* restrict destination);
+/// @brief Simplex noise in 3D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_simplex, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+float* SL_noise3D_simplex_Batch(const vec3* p, uint count, float* restrict destination);
+/// @brief Simplex noise in 4D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise4D_simplex, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+float* SL_noise4D_simplex_Batch(const vec4* p, uint count, float* restrict destination);
+
+
+/// @brief Perlin noise in 2D with its gradient
+/// @param p The position
+/// @return The noise value in x and its gradient in (y, z)
+/// @note The value is exactly SL_noise2D_perlin(p), the gradient is analytic (no finite differences)
+vec3 SL_noise2D_perlin_Deriv(vec2 p);
+/// @brief Perlin noise in 3D with its gradient
+/// @param p The position
+/// @return The noise value in x and its gradient in (y, z, w)
+/// @note The value is exactly SL_noise3D_perlin(p), the gradient is analytic (no finite differences)
+vec4 SL_noise3D_perlin_Deriv(vec3 p);
+
+/// @brief Perlin noise in 2D with its gradient at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_perlin_Deriv, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+vec3* SL_noise2D_perlin_Deriv_Batch(const vec2* p, uint count, vec3* restrict destination);
+/// @brief Perlin noise in 3D with its gradient at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_perlin_Deriv, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+vec4* SL_noise3D_perlin_Deriv_Batch(const vec3* p, uint count, vec4* restrict destination);
+
+/// @brief Simplex noise in 2D with its gradient
+/// @param p The position
+/// @return The noise value in x and its gradient in (y, z)
+/// @note The value is exactly SL_noise2D_simplex(p), the gradient is analytic (no finite differences)
+vec3 SL_noise2D_simplex_Deriv(vec2 p);
+/// @brief Simplex noise in 3D with its gradient
+/// @param p The position
+/// @return The noise value in x and its gradient in (y, z, w)
+/// @note The value is exactly SL_noise3D_simplex(p), the gradient is analytic (no finite differences)
+vec4 SL_noise3D_simplex_Deriv(vec3 p);
+
+/// @brief Simplex noise in 2D with its gradient at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_simplex_Deriv, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+vec3* SL_noise2D_simplex_Deriv_Batch(const vec2* p, uint count, vec3* restrict destination);
+/// @brief Simplex noise in 3D with its gradient at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_simplex_Deriv, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+vec4* SL_noise3D_simplex_Deriv_Batch(const vec3* p, uint count, vec4* restrict destination);
+
+
+/// @brief Worley (cellular) noise sample
+typedef struct WorleySample {
+    float f1;       // Distance to the closest feature point
+    float f2;       // Distance to the second closest feature point
+    uint32 id;      // Hash of the cell of the closest feature point, constant over its whole region
+} worley_sample;
+
+/// @brief Worley noise in 2D
+/// @param p The position
+/// @return The distances to the two closest feature points (one per lattice cell) and the cell of the closest one
+/// @note Use f2 - f1 for cell borders, and id to give each region its own value
+/// @note Only searches the 3x3 cells around p: in rare configurations (about 1 sample in 10 000 for f2, far less for f1) a closer point two cells away is missed
+worley_sample SL_noise2D_worley(vec2 p);
+/// @brief Worley noise in 3D
+/// @param p The position
+/// @return The distances to the two closest feature points (one per lattice cell) and the cell of the closest one
+/// @note Use f2 - f1 for cell borders, and id to give each region its own value
+/// @note Only searches the 3x3x3 cells around p: in rare configurations (about 1 sample in 10 000 for f2, far less for f1) a closer point two cells away is missed
+worley_sample SL_noise3D_worley(vec3 p);
+
+/// @brief Worley noise in 2D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_worley, in branch-free loops vectorized by the compiler across the positions
+/// @return The destination value
+worley_sample* SL_noise2D_worley_Batch(const vec2* p, uint count, worley_sample* restrict destination);
+/// @brief Worley noise in 3D at many positions
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_worley, in branch-free loops vectorized by the compiler across the positions
+/// @return The destination value
+worley_sample* SL_noise3D_worley_Batch(const vec3* p, uint count, worley_sample* restrict destination);
+
+
+///// GRID EVALUATION
+
+/// @brief Fill a buffer with 2D Voronoi noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_voronoi, but each lattice feature point is hashed only once
+/// @return The destination value
+float* SL_noise2D_voronoi_Grid(vec2 origin, vec2 step, uvec2 size, float* restrict destination);
+/// @brief Fill a buffer with 3D Voronoi noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y, z) at index x + size.x * (y + size.y * z))
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_voronoi, but each lattice feature point is hashed only once
+/// @return The destination value
+float* SL_noise3D_voronoi_Grid(vec3 origin, vec3 step, uvec3 size, float* restrict destination);
+
+/// @brief Fill a buffer with 2D Perlin noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_perlin, but each lattice gradient is hashed only once
+/// @return The destination value
+float* SL_noise2D_perlin_Grid(vec2 origin, vec2 step, uvec2 size, float* restrict destination);
+/// @brief Fill a buffer with 3D Perlin noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y, z) at index x + size.x * (y + size.y * z))
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_perlin, but each lattice gradient is hashed only once
+/// @return The destination value
+float* SL_noise3D_perlin_Grid(vec3 origin, vec3 step, uvec3 size, float* restrict destination);
+
+/// @brief Fill a buffer with 2D Worley noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise2D_worley, but each lattice feature point is hashed only once
+/// @return The destination value
+worley_sample* SL_noise2D_worley_Grid(vec2 origin, vec2 step, uvec2 size, worley_sample* restrict destination);
+/// @brief Fill a buffer with 3D Worley noise sampled over a regular grid
+/// @param origin The position of the first sample
+/// @param step The offset between two neighbouring samples along each axis
+/// @param size The number of samples along each axis
+/// @param destination Where the results are stored (sample (x, y, z) at index x + size.x * (y + size.y * z))
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_noise3D_worley, but each lattice feature point is hashed only once
+/// @return The destination value
+worley_sample* SL_noise3D_worley_Grid(vec3 origin, vec3 step, uvec3 size, worley_sample* restrict destination);
+
+#endif
\ No newline at end of file
@@ -1,597 +1,756 @@
-#ifndef __SL_MATHS_QUATERNION_H__
-#define __SL_MATHS_QUATERNION_H__
-
-#include "vector.h"
-
-/// @brief Quaternion (w, x, y, z) = w + ix + jy + kz
-/// @note where i² = j² = k² = ijk = -1
-typedef union Quaternion {
-    struct { float w, x, y, z; };
-    struct { float r, i, j, k; };
-    struct { float u; vec3 v;  };
-    vec4 asV4;
-    float m[4];
-} quat;
-
-/// @brief The identity quaternion representing no rotation: (1, 0, 0, 0)
-extern const quat quat_identity;
-
-#define FMT_QUAT "%f + %fi + %fj + %fk"
-#define XPD_QUAT(q) q.w, q.x, q.y, q.z
-#define XPD_QUAT_(q) q->w, q->x, q->y, q->z
-
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////// STRUCT QUATERNIONS ///////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-
-
-
-/// @brief Create a quaternion
-/// @param w w component
-/// @param x x component
-/// @param y y component
-/// @param z z component
-/// @return The newly created quaternion
-static inline quat Quat(float w, float x, float y, float z) { 
-    return (quat) {x, y, z, w};
-    quat a;
-}
-/// @brief Create a quaternion from real and imaginary parts
-/// @param r real part
-/// @param i imaginary part
-/// @return The newly created quaternion
-static inline quat Quat_V(float r, const vec3 i) {
-    return (quat) {r, XPD_VEC3(i)};
-}
-/// @brief Create a quaternion from euler angles
-/// @param yaw The angle around Y
-/// @param pitch The angle from the floor
-/// @param roll The angle around ViewAxis
-/// @return The newly created quaternion
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-static inline quat Quat_Euler(float yaw, float pitch, float roll) {
-    double cy = cos(yaw * 0.5);
-    double sy = sin(yaw * 0.5);
-    double cp = cos(pitch * 0.5);
-    double sp = sin(pitch * 0.5);
-    double cr = cos(roll * 0.5);
-    double sr = sin(roll * 0.5);
-
-    return (quat) {
-        cy * cp * cr - sy * sp * sr,
-        cy * sp * cr - sy * cp * sr,
-        cy * sp * sr + sy * cp * cr,
-        cy * cp * sr + sy * sp * cr
-    };
-}
-/// @brief Create a quaternion from euler angles vector
-/// @param v The vector of euler angles
-/// @return The newly created quaternion
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-static inline quat Quat_EulerVector(const vec3 v) {
-    return Quat_Euler(XPD_VEC3(v));
-}
-/// @brief Create a quaternion from angle axis
-/// @param angle The angle of rotation
-/// @param axis The axis of rotation
-/// @return The newly created quaternion
-static inline quat Quat_AngleAxis(float angle, const vec3 v) {
-    angle *= 0.5;
-    float sinA = sin(angle);
-    return (quat) {cos(angle), sinA * v.x, sinA * v.y, sinA * v.z};
-}
-/// @brief Create a quaternion from rotation vector
-/// @param v The rotation vector
-/// @return The newly created quaternion
-static inline quat Quat_RotVec(const vec3 v) {
-    float length = len3(v);
-    if (length == 0.0) return quat_identity;
-
-    float halfAngle = length * 0.5;
-    float coeff = sin(halfAngle) / length;
-
-    return Quat(cos(halfAngle), v.x * coeff, v.y * coeff, v.z * coeff);
-}
-/// @brief Create a quaternion from a vector to another
-/// @param from The source
-/// @param to The destination
-/// @return The newly created quaternion
-static inline quat Quat_FromToVec(const vec3 from, const vec3 to) {
-    vec3 axis = cross3(from, to);
-    if (axis.x || axis.y || axis.z) {
-        axis = norm3(axis);
-        float angle = acos(dot3(from, to));
-        return Quat_AngleAxis(angle, axis);
-    }
-    return quat_identity;
-}
-
-/// @brief Add two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The resulting quaternion
-static inline quat addQ(const quat a, const quat b) {
-    return (quat) {a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z};
-}
-/// @brief Subtract two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The resulting quaternion
-static inline quat subQ(const quat a, const quat b) {
-    return (quat) {a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z};
-}
-/// @brief Multiply two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The resulting quaternion
-static inline quat mulQ(const quat a, const quat b) {
-    return (quat) {
-        (b.w * a.w) - (b.x * a.x) - (b.y * a.y) - (b.z * a.z),
-        (b.w * a.x) + (b.x * a.w) - (b.y * a.z) + (b.z * a.y),
-        (b.w * a.y) + (b.x * a.z) + (b.y * a.w) - (b.z * a.x),
-        (b.w * a.z) - (b.x * a.y) + (b.y * a.x) + (b.z * a.w)
-    };
-}
-
-/// @brief Scale a quaternion by a factor
-/// @param q The quaternion
-/// @param s The factor
-/// @return The resulting quaternion
-static inline quat scaleQ(const quat q, float s) {
-    return (quat) {q.w * s, q.x * s, q.y * s, q.z * s};
-}
-/// @brief Get length of a quaternion
-/// @param q The quaternion
-/// @return The length of the quaternion
-static inline float lenQ(const quat q) {
-    return q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
-}
-/// @brief Normalize a quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-static inline quat normQ(const quat q) {
-    return scaleQ(q, 1.0 / lenQ(q));
-}
-/// @brief Transpose a quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-static inline quat transpQ(const quat q) {
-    return (quat) {q.w, -q.x, -q.y, -q.z};
-}
-/// @brief Invert a quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-static inline quat invQ(const quat q) {
-    return transpQ(normQ(q));
-}
-/// @brief Divide two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The resulting quaternion
-static inline quat divQ(const quat a, const quat b) {
-    return mulQ(a, invQ(b));
-}
-
-/// @brief Exponential of a quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-static inline quat expQ(const quat q) {
-    float ex = exp(q.w);
-    float a = sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
-    float s = a == 0.0 ? 0.0 : ex * sin(a) / a;
-
-    return (quat) {ex * cos(a), q.x * s, q.y * s, q.z * s};
-}
-/// @brief Natural logarithm of a quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-static inline quat lnQ(const quat q) {
-    float l = lenQ(q);
-    float arg = l == 0.0 ? 0.0 : acos(q.w / l) / sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
-
-    return (quat) {log(l), q.x * arg, q.y * arg, q.z * arg};
-}
-/// @brief Exponential of a unit quaternion
-/// @param q The quaternion
-/// @return The resulting quaternion
-/// @note The quaternion is supposed to be unit, a.k.a of length 1. This speeds up the computation.
-static inline quat lnQ_Unit(const quat q) {
-    float arg = acos(q.w);
-    return (quat) {0, q.x * arg, q.y * arg, q.z * arg};
-}
-/// @brief Power of a quaternion
-/// @param q The quaternion
-/// @param t the power
-/// @return The resulting quaternion
-static inline quat powQ(const quat q, float t) {
-    float l = len3(*(vec3*)&q.x);
-    if (l == 0.0) return quat_identity;
-
-    float angle = acos(q.w) * t;
-    return Quat_V(cos(angle), scale3(*(vec3*)&q.x, sin(angle) / l));
-}
-
-static inline quat slerpQ(const quat a, const quat b, float t) {
-    // c = a * (a^-1 * b)^t
-    return mulQ(a, powQ(mulQ(invQ(a), b), t));
-}
-static inline quat slerpQ_Unit(const quat a, const quat b, float t) {
-    // c = a * (a^-1 * b)^t
-    return mulQ(a, powQ(mulQ(transpQ(a), b), t));
-}
-
-
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////// POINTER QUATERNIONS ///////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-
-
-/// @brief Create a quaternion
-/// @param w w component
-/// @param x x component
-/// @param y y component
-/// @param z z component
-/// @return The newly created quaternion
-quat* newQuat(float w, float x, float y, float z);
-/// @brief Create a quaternion
-/// @param w w component
-/// @param x x component
-/// @param y y component
-/// @param z z component
-/// @return The newly created quaternion
-quat* Quat_(float w, float x, float y, float z);
-
-/// @brief Set a quaternion
-/// @param q The quaternion to set
-/// @param w The new w component
-/// @param x The new x component
-/// @param y The new y component
-/// @param z The new z component
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_(quat* restrict q, float w, float x, float y, float z);
-/// @brief Set a quaternion from real and imaginary parts
-/// @param r real part
-/// @param i imaginary part
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_V(quat* restrict q, float r, vec3 i);
-/// @brief Set a quaternion from Euler angles
-/// @param q The quaternion to set
-/// @param yaw The angle around Y
-/// @param pitch The angle from the floor
-/// @param roll The angle around ViewAxis
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_Euler_(quat* restrict q, float yaw, float pitch, float roll);
-/// @brief Set a quaternion from Euler angles
-/// @param q The quaternion to set
-/// @param v The Euler angles vector
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_EulerVector_(quat* restrict q, const vec3* v);
-/// @brief Set a quaternion from angle-axis
-/// @param q The quaternion to set
-/// @param angle The angle around axis
-/// @param axis The axis
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_AngleAxis_(quat* restrict q, float angle, const vec3* axis);
-/// @brief Set a quaternion from rotation vector
-/// @param q The quaternion to set
-/// @param v The rotation vector
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_RotVec_(quat* restrict q, const vec3* v);
-/// @brief Set a quaternion from a vector to another
-/// @param q The quaternion to set
-/// @param from The source
-/// @param to The destination
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* setQ_FromToVec_(quat* restrict q, const vec3* from, const vec3* to);
-
-/// @brief Create a quaternion from real and imaginary parts
-/// @param r real part
-/// @param i imaginary part
-/// @return The newly created quaternion
-quat* newQuat_V(float r, const vec3 i);
-/// @brief Create a quaternion from euler angles
-/// @param yaw The angle around Y
-/// @param pitch The angle from the floor
-/// @param roll The angle around ViewAxis
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-/// @return The newly created quaternion
-quat* newQuat_Euler(float yaw, float pitch, float roll);
-/// @brief Create a quaternion from euler angles vector
-/// @param v The vector of euler angles
-/// @return The newly created quaternion
-/// @note Rotations are applied in this order: (roll, pitch, yaw)
-/// @note Thank you wikipedia
-quat* newQuat_EulerVector(const vec3* v);
-/// @brief Create a quaternion from angle axis
-/// @param angle The angle of rotation
-/// @param axis The axis of rotation
-/// @return The newly created quaternion
-quat* newQuat_AngleAxis(float angle, const vec3* axis);
-/// @brief Create a quaternion from rotation vector
-/// @param v The rotation vector
-/// @return The newly created quaternion
-quat* newQuat_RotVec(const vec3* v);
-/// @brief Create a quaternion from a vector to another
-/// @param from The source
-/// @param to The destination
-/// @return The newly created quaternion
-quat* newQuat_FromToVec(const vec3* from, const vec3* to);
-
-/// @brief Free quaternion
-/// @param toFree The quaternion to free
-void freeQuat(quat* toFree);
-
-/// @brief Create an identity quaternion: (1, 0, 0, 0)
-/// @return The newly created identity quaternion
-quat* identityQ_(void);
-
-/// @brief Copy value of a quaternion
-/// @param q The quaternion to copy
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* copyQ_(const quat* q, quat* destination);
-
-
-
-/// @brief Add two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* addQ_(const quat* a, const quat* b, quat* destination);
-/// @brief Add two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The input quaternion (left)
-/// @note This opperation overrides the current value
-quat* addQ_s(quat* a, const quat* b);
-
-/// @brief Substract two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* subQ_(const quat* a, const quat* b, quat* destination);
-/// @brief Substract two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The input quaternion (left)
-/// @note This opperation overrides the current value
-quat* subQ_s(quat* a, const quat* b);
-
-/// @brief Multiply two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* mulQ_(const quat* a, const quat* b, quat* destination);
-/// @brief Multiply two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @return The input quaternion (left)
-/// @note This opperation overrides the current value
-quat* mulQ_s(quat* a, const quat* b);
-
-/// @brief Scale a quaternion be a scalar
-/// @param q The quaternion to scale
-/// @param s The amount
-/// @param destination Where the result is stored
-/// @return The destination value
-/// @note Set destination to NULL for new value
-quat* scaleQ_(const quat* q, float s, quat* destination);
-/// @brief Scale a quaternion be a scalar
-/// @param q The quaternion to scale
-/// @param s The amount
-/// @note This opperation overrides the current value
-/// @return The input quaternion
-quat* scaleQ_s(quat* restrict q, float s);
-
-/// @brief Length of a quaternion
-/// @param q The input quaternion
-/// @return The length of the quaternion (norm 2)
-float lenQ_(const quat* q);
-/// @brief Set quaternion length to 1
-/// @param q The quaternion to normalize
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* normQ_(const quat* q, quat* restrict destination);
-/// @brief Set quaternion length to 1
-/// @param q The quaternion to normalize
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* normQ_s(quat* restrict q);
-
-/// @brief Transpose a quaternion
-/// @param q The quaternion to transpose
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* transpQ_(const quat* q, quat* destination);
-/// @brief Transpose a quaternion
-/// @param q The quaternion to transpose
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* transpQ_s(quat* restrict q);
-/// @brief Invert quaternion
-/// @param q The quaternion to invert
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @note If the quaternion is known to ne unit, then the inverse is equal to the transpose. Therefore it is best to use "transposeQ" for performance
-/// @return The destination value
-quat* invQ_(const quat* q, quat* destination);
-/// @brief Invert quaternion
-/// @param q The quaternion to invert
-/// @note If the quaternion is known to ne unit, then the inverse is equal to the transpose. Therefore it is best to use "transposeQ" for performance
-/// @note This opperation overrides the current value
-/// @return The input quaternion
-quat* invQ_s(quat* restrict q);
-
-/// @brief Divide two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* divQ_(const quat* a, const quat* b, quat* c);
-/// @brief Divide two quaternions
-/// @param a The left quaternion
-/// @param b The right quaternion
-/// @note This opperation overrides the current value
-/// @return The input quaternion (left)
-quat* divQ_s(quat* restrict a, const quat* b);
-
-/// @brief Rotate a vec3 by quaternion
-/// @param v The vector to rotate
-/// @param q The rotation quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @note The input quaternion is assumed to be unit
-/// @return The destination value
-vec3* rot3Q_(const vec3* v, const quat* q, vec3* destination);
-/// @brief Rotate a vec3 by quaternion
-/// @param v The vector to rotate
-/// @param q The rotation quaternion
-/// @note This opperation overrides the current value
-/// @note The input quaternion is assumed to be unit
-/// @return The input vector
-vec3* rot3Q_s(vec3* v, const quat* q);
-/// @brief Rotate a vec3 by transposed quaternion
-/// @param v The vector to rotate
-/// @param q The rotation quaternion
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @note The input quaternion is assumed to be unit
-/// @return The destination value
-vec3* rot3TQ_(const vec3* v, const quat* q, vec3* destination);
-/// @brief Rotate a vec3 by transposed quaternion
-/// @param v The vector to rotate
-/// @param q The rotation quaternion
-/// @note This opperation overrides the current value
-/// @note The input quaternion is assumed to be unit
-/// @return The input vector
-vec3* rot3TQ_s(vec3* v, const quat* q);
-
-/// @brief Exponential of a quaternion
-/// @param q The quaternion as argument
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* expQ_(const quat* q, quat* restrict destination);
-/// @brief Exponential of a quaternion
-/// @param q The quaternion as argument
-/// @return The input quaternion
-/// @note This opperation overrides the current value
-quat* expQ_s(quat* restrict q);
-
-/// @brief Logarithm of a quaternion
-/// @param q The quaternion as argument
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* lnQ_(const quat* q, quat* restrict destination);
-/// @brief Logarithm of a quaternion
-/// @param q The quaternion as argument
-/// @note This opperation overrides the current value
-/// @return The input quaternion
-quat* lnQ_s(quat* restrict q);
-/// @brief Logarithm of a unit quaternion
-/// @param q The quaternion as argument
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* lnQ_Unit_(const quat* q, quat* restrict destination);
-/// @brief Logarithm of a unit quaternion
-/// @param q The quaternion as argument
-/// @note This opperation overrides the current value
-/// @return The input quaternion
-quat* lnQ_Unit_s(quat* restrict q);
-
-/// @brief Power of a quaternion
-/// @param q The quaternion in the base
-/// @param t The exponent
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-quat* powQ_(const quat* q, float t, quat* restrict destination);
-/// @brief Exponential of a quaternion
-/// @param q The quaternion in the base
-/// @param t The exponent
-/// @note This opperation overrides the current value
-/// @return The input quaternion
-quat* powQ_s(quat* restrict q, float t);
-
-/// @brief Spherical interpolation between quat a and quat b with factor t
-/// @param a The start position
-/// @param b The end position
-/// @param t The factor (Supposed in the range [0, 1])
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @note Represents shortest path on unit hypersphere between a and b with factor t
-/// @return The destination value
-quat* slerpQ_(const quat* a, const quat* b, float t, quat* restrict destination);
-/// @brief Spherical interpolation between quat a and quat b with factor t
-/// @param a The start position
-/// @param b The end position
-/// @param t The factor (Supposed in the range [0, 1])
-/// @note This opperation overrides the current value
-/// @note Represents shortest path on unit hypersphere between a and b with factor t
-/// @return The input quaternion
-quat* slerpQ_s(quat* restrict a, const quat* b, float t);
-/// @brief Spherical interpolation between unit quat a and unit quat b with factor t
-/// @param a The start position
-/// @param b The end position
-/// @param t The factor (Supposed in the range [0, 1])
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @note Represents shortest path on unit hypersphere between a and b with factor t
-/// @return The destination value
-quat* slerpQ_Unit_(const quat* a, const quat* b, float t, quat* restrict destination);
-/// @brief Spherical interpolation between unit quat a and unit quat b with factor t
-/// @param a The start position
-/// @param b The end position
-/// @param t The factor (Supposed in the range [0, 1])
-/// @note This opperation overrides the current value
-/// @note Represents shortest path on unit hypersphere between a and b with factor t
-/// @return The input quaternion
-quat* slerpQ_Unit_s(quat* restrict a, const quat* b, float t);
-
-/// @brief Convert quaternion to rotation vector
-/// @param q The quaternion to convert
-/// @param destination Where the result is stored
-/// @note Set destination to NULL for new value
-/// @return The destination value
-vec3* quatToVec3_Rot_(const quat* q, vec3* restrict destination);
-
-/// @brief Convert quaterion to euler angles
-/// @param q The quaternion to convert
-/// @param destination Where the result is stored
-/// @return The destination value
-/// @note Set destination to NULL for new value
-/// @note Angles are in (roll, pitch, yaw) order
-/// @note Base on this paper: https://pmc.ncbi.nlm.nih.gov/articles/PMC9648712/
-vec3* quatToVec3_Euler_(const quat* q, vec3* restrict destination);
-
+#ifndef __SL_MATHS_QUATERNION_H__
+#define __SL_MATHS_QUATERNION_H__
+
+#include "vector.h"
+
+/// @brief Quaternion (w, x, y, z) = w + ix + jy + kz
+/// @note where i² = j² = k² = ijk = -1
+typedef union Quaternion {
+    struct { float w, x, y, z; };
+    struct { float r, i, j, k; };
+    struct { float u; vec3 v;  };
+    vec4 asV4;
+    float m[4];
+} quat;
+
+/// @brief The identity quaternion representing no rotation: (1, 0, 0, 0)
+extern const quat quat_identity;
+
+#define FMT_QUAT "%f + %fi + %fj + %fk"
+#define XPD_QUAT(q) q.w, q.x, q.y, q.z
+#define XPD_QUAT_(q) q->w, q->x, q->y, q->z
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// STRUCT QUATERNIONS ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+/// @brief Create a quaternion
+/// @param w w component
+/// @param x x component
+/// @param y y component
+/// @param z z component
+/// @return The newly created quaternion
+static inline quat Quat(float w, float x, float y, float z) { 
+    return (quat) {x, y, z, w};
+    quat a;
+}
+/// @brief Create a quaternion from real and imaginary parts
+/// @param r real part
+/// @param i imaginary part
+/// @return The newly created quaternion
+static inline quat Quat_V(float r, const vec3 i) {
+    return (quat) {r, XPD_VEC3(i)};
+}
+/// @brief Create a quaternion from euler angles
+/// @param yaw The angle around Y
+/// @param pitch The angle from the floor
+/// @param roll The angle around ViewAxis
+/// @return The newly created quaternion
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+static inline quat Quat_Euler(float yaw, float pitch, float roll) {
+    double cy = cos(yaw * 0.5);
+    double sy = sin(yaw * 0.5);
+    double cp = cos(pitch * 0.5);
+    double sp = sin(pitch * 0.5);
+    double cr = cos(roll * 0.5);
+    double sr = sin(roll * 0.5);
+
+    return (quat) {
+        cy * cp * cr - sy * sp * sr,
+        cy * sp * cr - sy * cp * sr,
+        cy * sp * sr + sy * cp * cr,
+        cy * cp * sr + sy * sp * cr
+    };
+}
+/// @brief Create a quaternion from euler angles vector
+/// @param v The vector of euler angles
+/// @return The newly created quaternion
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+static inline quat Quat_EulerVector(const vec3 v) {
+    return Quat_Euler(XPD_VEC3(v));
+}
+/// @brief Create a quaternion from angle axis
+/// @param angle The angle of rotation
+/// @param axis The axis of rotation
+/// @return The newly created quaternion
+static inline quat Quat_AngleAxis(float angle, const vec3 v) {
+    angle *= 0.5;
+    float sinA = sin(angle);
+    return (quat) {cos(angle), sinA * v.x, sinA * v.y, sinA * v.z};
+}
+/// @brief Create a quaternion from rotation vector
+/// @param v The rotation vector
+/// @return The newly created quaternion
+static inline quat Quat_RotVec(const vec3 v) {
+    float length = len3(v);
+    if (length == 0.0) return quat_identity;
+
+    float halfAngle = length * 0.5;
+    float coeff = sin(halfAngle) / length;
+
+    return Quat(cos(halfAngle), v.x * coeff, v.y * coeff, v.z * coeff);
+}
+/// @brief Create a quaternion from a vector to another
+/// @param from The source
+/// @param to The destination
+/// @return The newly created quaternion
+static inline quat Quat_FromToVec(const vec3 from, const vec3 to) {
+    vec3 axis = cross3(from, to);
+    if (axis.x || axis.y || axis.z) {
+        axis = norm3(axis);
+        float angle = acos(dot3(from, to));
+        return Quat_AngleAxis(angle, axis);
+    }
+    return quat_identity;
+}
+
+/// @brief Add two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The resulting quaternion
+static inline quat addQ(const quat a, const quat b) {
+    return (quat) {a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z};
+}
+/// @brief Subtract two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The resulting quaternion
+static inline quat subQ(const quat a, const quat b) {
+    return (quat) {a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z};
+}
+/// @brief Multiply two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The resulting quaternion
+static inline quat mulQ(const quat a, const quat b) {
+    return (quat) {
+        (b.w * a.w) - (b.x * a.x) - (b.y * a.y) - (b.z * a.z),
+        (b.w * a.x) + (b.x * a.w) - (b.y * a.z) + (b.z * a.y),
+        (b.w * a.y) + (b.x * a.z) + (b.y * a.w) - (b.z * a.x),
+        (b.w * a.z) - (b.x * a.y) + (b.y * a.x) + (b.z * a.w)
+    };
+}
+
+/// @brief Scale a quaternion by a factor
+/// @param q The quaternion
+/// @param s The factor
+/// @return The resulting quaternion
+static inline quat scaleQ(const quat q, float s) {
+    return (quat) {q.w * s, q.x * s, q.y * s, q.z * s};
+}
+/// @brief Get length of a quaternion
+/// @param q The quaternion
+/// @return The length of the quaternion
+static inline float lenQ(const quat q) {
+    return q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z;
+}
+/// @brief Normalize a quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+static inline quat normQ(const quat q) {
+    return scaleQ(q, 1.0 / lenQ(q));
+}
+/// @brief Transpose a quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+static inline quat transpQ(const quat q) {
+    return (quat) {q.w, -q.x, -q.y, -q.z};
+}
+/// @brief Invert a quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+static inline quat invQ(const quat q) {
+    return transpQ(normQ(q));
+}
+/// @brief Divide two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The resulting quaternion
+static inline quat divQ(const quat a, const quat b) {
+    return mulQ(a, invQ(b));
+}
+
+/// @brief Exponential of a quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+static inline quat expQ(const quat q) {
+    float ex = exp(q.w);
+    float a = sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+    float s = a == 0.0 ? 0.0 : ex * sin(a) / a;
+
+    return (quat) {ex * cos(a), q.x * s, q.y * s, q.z * s};
+}
+/// @brief Natural logarithm of a quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+static inline quat lnQ(const quat q) {
+    float l = lenQ(q);
+    float arg = l == 0.0 ? 0.0 : acos(q.w / l) / sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+
+    return (quat) {log(l), q.x * arg, q.y * arg, q.z * arg};
+}
+/// @brief Exponential of a unit quaternion
+/// @param q The quaternion
+/// @return The resulting quaternion
+/// @note The quaternion is supposed to be unit, a.k.a of length 1. This speeds up the computation.
+static inline quat lnQ_Unit(const quat q) {
+    float arg = acos(q.w);
+    return (quat) {0, q.x * arg, q.y * arg, q.z * arg};
+}
+/// @brief Power of a quaternion
+/// @param q The quaternion
+/// @param t the power
+/// @return The resulting quaternion
+static inline quat powQ(const quat q, float t) {
+    float l = len3(*(vec3*)&q.x);
+    if (l == 0.0) return quat_identity;
+
+    float angle = acos(q.w) * t;
+    return Quat_V(cos(angle), scale3(*(vec3*)&q.x, sin(angle) / l));
+}
+
+static inline quat slerpQ(const quat a, const quat b, float t) {
+    // c = a * (a^-1 * b)^t
+    return mulQ(a, powQ(mulQ(invQ(a), b), t));
+}
+static inline quat slerpQ_Unit(const quat a, const quat b, float t) {
+    // c = a * (a^-1 * b)^t
+    return mulQ(a, powQ(mulQ(transpQ(a), b), t));
+}
+/// @brief Fast approximate spherical interpolation between unit quaternions
+/// @param a The start position
+/// @param b The end position
+/// @param t The factor (Supposed in the range [0, 1])
+/// @return The interpolated unit quaternion
+/// @note Normalized lerp with a polynomial correction of t, no trigonometry involved
+/// @note Deviates from slerp by less than 1.5e-3 radians (0.09 degrees) of rotation, for any pair of inputs
+/// @note Always follows the shortest path (b is flipped when a.b < 0)
+static inline quat slerpQ_Fast(const quat a, const quat b, float t) {
+    float d = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    float ad = fabsf(d);
+
+    // Fitted correction of t so that the angular speed of nlerp matches slerp's
+    float A = 1.0904f + ad * (-3.2452f + ad * (3.55645f - ad * 1.43519f));
+    float B = 0.848013f + ad * (-1.06021f + ad * 0.215638f);
+    float h = t - 0.5f;
+    float u = t + t * h * (t - 1.0f) * (A * h * h + B);
+
+    float r = 1.0f - u, s = d < 0.0f ? -u : u;
+    quat q = {a.w * r + b.w * s, a.x * r + b.x * s, a.y * r + b.y * s, a.z * r + b.z * s};
+    return scaleQ(q, 1.0f / sqrtf(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z));
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// POINTER QUATERNIONS ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @brief Create a quaternion
+/// @param w w component
+/// @param x x component
+/// @param y y component
+/// @param z z component
+/// @return The newly created quaternion
+quat* newQuat(float w, float x, float y, float z);
+/// @brief Create a quaternion
+/// @param w w component
+/// @param x x component
+/// @param y y component
+/// @param z z component
+/// @return The newly created quaternion
+quat* Quat_(float w, float x, float y, float z);
+
+/// @brief Set a quaternion
+/// @param q The quaternion to set
+/// @param w The new w component
+/// @param x The new x component
+/// @param y The new y component
+/// @param z The new z component
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_(quat* restrict q, float w, float x, float y, float z);
+/// @brief Set a quaternion from real and imaginary parts
+/// @param r real part
+/// @param i imaginary part
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_V(quat* restrict q, float r, vec3 i);
+/// @brief Set a quaternion from Euler angles
+/// @param q The quaternion to set
+/// @param yaw The angle around Y
+/// @param pitch The angle from the floor
+/// @param roll The angle around ViewAxis
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_Euler_(quat* restrict q, float yaw, float pitch, float roll);
+/// @brief Set a quaternion from Euler angles
+/// @param q The quaternion to set
+/// @param v The Euler angles vector
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_EulerVector_(quat* restrict q, const vec3* v);
+/// @brief Set a quaternion from angle-axis
+/// @param q The quaternion to set
+/// @param angle The angle around axis
+/// @param axis The axis
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_AngleAxis_(quat* restrict q, float angle, const vec3* axis);
+/// @brief Set a quaternion from rotation vector
+/// @param q The quaternion to set
+/// @param v The rotation vector
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_RotVec_(quat* restrict q, const vec3* v);
+/// @brief Set a quaternion from a vector to another
+/// @param q The quaternion to set
+/// @param from The source
+/// @param to The destination
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* setQ_FromToVec_(quat* restrict q, const vec3* from, const vec3* to);
+
+/// @brief Create a quaternion from real and imaginary parts
+/// @param r real part
+/// @param i imaginary part
+/// @return The newly created quaternion
+quat* newQuat_V(float r, const vec3 i);
+/// @brief Create a quaternion from euler angles
+/// @param yaw The angle around Y
+/// @param pitch The angle from the floor
+/// @param roll The angle around ViewAxis
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+/// @return The newly created quaternion
+quat* newQuat_Euler(float yaw, float pitch, float roll);
+/// @brief Create a quaternion from euler angles vector
+/// @param v The vector of euler angles
+/// @return The newly created quaternion
+/// @note Rotations are applied in this order: (roll, pitch, yaw)
+/// @note Thank you wikipedia
+quat* newQuat_EulerVector(const vec3* v);
+/// @brief Create a quaternion from angle axis
+/// @param angle The angle of rotation
+/// @param axis The axis of rotation
+/// @return The newly created quaternion
+quat* newQuat_AngleAxis(float angle, const vec3* axis);
+/// @brief Create a quaternion from rotation vector
+/// @param v The rotation vector
+/// @return The newly created quaternion
+quat* newQuat_RotVec(const vec3* v);
+/// @brief Create a quaternion from a vector to another
+/// @param from The source
+/// @param to The destination
+/// @return The newly created quaternion
+quat* newQuat_FromToVec(const vec3* from, const vec3* to);
+
+/// @brief Free quaternion
+/// @param toFree The quaternion to free
+void freeQuat(quat* toFree);
+
+/// @brief Create an identity quaternion: (1, 0, 0, 0)
+/// @return The newly created identity quaternion
+quat* identityQ_(void);
+
+/// @brief Copy value of a quaternion
+/// @param q The quaternion to copy
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* copyQ_(const quat* q, quat* destination);
+
+
+
+/// @brief Add two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* addQ_(const quat* a, const quat* b, quat* destination);
+/// @brief Add two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The input quaternion (left)
+/// @note This opperation overrides the current value
+quat* addQ_s(quat* a, const quat* b);
+
+/// @brief Substract two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* subQ_(const quat* a, const quat* b, quat* destination);
+/// @brief Substract two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The input quaternion (left)
+/// @note This opperation overrides the current value
+quat* subQ_s(quat* a, const quat* b);
+
+/// @brief Multiply two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* mulQ_(const quat* a, const quat* b, quat* destination);
+/// @brief Multiply two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @return The input quaternion (left)
+/// @note This opperation overrides the current value
+quat* mulQ_s(quat* a, const quat* b);
+
+/// @brief Scale a quaternion be a scalar
+/// @param q The quaternion to scale
+/// @param s The amount
+/// @param destination Where the result is stored
+/// @return The destination value
+/// @note Set destination to NULL for new value
+quat* scaleQ_(const quat* q, float s, quat* destination);
+/// @brief Scale a quaternion be a scalar
+/// @param q The quaternion to scale
+/// @param s The amount
+/// @note This opperation overrides the current value
+/// @return The input quaternion
+quat* scaleQ_s(quat* restrict q, float s);
+
+/// @brief Length of a quaternion
+/// @param q The input quaternion
+/// @return The length of the quaternion (norm 2)
+float lenQ_(const quat* q);
+/// @brief Set quaternion length to 1
+/// @param q The quaternion to normalize
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* normQ_(const quat* q, quat* restrict destination);
+/// @brief Set quaternion length to 1
+/// @param q The quaternion to normalize
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* normQ_s(quat* restrict q);
+
+/// @brief Transpose a quaternion
+/// @param q The quaternion to transpose
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* transpQ_(const quat* q, quat* destination);
+/// @brief Transpose a quaternion
+/// @param q The quaternion to transpose
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* transpQ_s(quat* restrict q);
+/// @brief Invert quaternion
+/// @param q The quaternion to invert
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @note If the quaternion is known to ne unit, then the inverse is equal to the transpose. Therefore it is best to use "transposeQ" for performance
+/// @return The destination value
+quat* invQ_(const quat* q, quat* destination);
+/// @brief Invert quaternion
+/// @param q The quaternion to invert
+/// @note If the quaternion is known to ne unit, then the inverse is equal to the transpose. Therefore it is best to use "transposeQ" for performance
+/// @note This opperation overrides the current value
+/// @return The input quaternion
+quat* invQ_s(quat* restrict q);
+
+/// @brief Divide two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* divQ_(const quat* a, const quat* b, quat* c);
+/// @brief Divide two quaternions
+/// @param a The left quaternion
+/// @param b The right quaternion
+/// @note This opperation overrides the current value
+/// @return The input quaternion (left)
+quat* divQ_s(quat* restrict a, const quat* b);
+
+/// @brief Rotate a vec3 by quaternion
+/// @param v The vector to rotate
+/// @param q The rotation quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @note The input quaternion is assumed to be unit
+/// @return The destination value
+vec3* rot3Q_(const vec3* v, const quat* q, vec3* destination);
+/// @brief Rotate a vec3 by quaternion
+/// @param v The vector to rotate
+/// @param q The rotation quaternion
+/// @note This opperation overrides the current value
+/// @note The input quaternion is assumed to be unit
+/// @return The input vector
+vec3* rot3Q_s(vec3* v, const quat* q);
+/// @brief Rotate a vec3 by transposed quaternion
+/// @param v The vector to rotate
+/// @param q The rotation quaternion
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @note The input quaternion is assumed to be unit
+/// @return The destination value
+vec3* rot3TQ_(const vec3* v, const quat* q, vec3* destination);
+/// @brief Rotate a vec3 by transposed quaternion
+/// @param v The vector to rotate
+/// @param q The rotation quaternion
+/// @note This opperation overrides the current value
+/// @note The input quaternion is assumed to be unit
+/// @return The input vector
+vec3* rot3TQ_s(vec3* v, const quat* q);
+
+/// @brief Rotate many vec3 by the same quaternion
+/// @param v The vectors to rotate
+/// @param count The number of vectors
+/// @param q The rotation quaternion
+/// @param destination Where the results are stored (may be v itself)
+/// @note Set destination to NULL for new value
+/// @note The input quaternion is assumed to be unit
+/// @note The rotation is expanded only once, then each vector costs a 3x3 product
+/// @return The destination value
+vec3* rot3Q_Batch_(const vec3* v, uint count, const quat* q, vec3* destination);
+/// @brief Rotate many vec3 by the same transposed quaternion
+/// @param v The vectors to rotate
+/// @param count The number of vectors
+/// @param q The rotation quaternion
+/// @param destination Where the results are stored (may be v itself)
+/// @note Set destination to NULL for new value
+/// @note The input quaternion is assumed to be unit
+/// @note The rotation is expanded only once, then each vector costs a 3x3 product
+/// @return The destination value
+vec3* rot3TQ_Batch_(const vec3* v, uint count, const quat* q, vec3* destination);
+/// @brief Rotate each vec3 of an array by the quaternion of same index in another array
+/// @param v The vectors to rotate
+/// @param q The rotation quaternions
+/// @param count The number of pairs
+/// @param destination Where the results are stored (may be v itself)
+/// @note Set destination to NULL for new value
+/// @note The input quaternions are assumed to be unit
+/// @note Pairs are transposed into SoA blocks and rotated in a vectorizable loop
+/// @return The destination value
+vec3* rot3Q_Pairs_(const vec3* v, const quat* q, uint count, vec3* destination);
+
+/// @brief Exponential of a quaternion
+/// @param q The quaternion as argument
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* expQ_(const quat* q, quat* restrict destination);
+/// @brief Exponential of a quaternion
+/// @param q The quaternion as argument
+/// @return The input quaternion
+/// @note This opperation overrides the current value
+quat* expQ_s(quat* restrict q);
+
+/// @brief Logarithm of a quaternion
+/// @param q The quaternion as argument
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* lnQ_(const quat* q, quat* restrict destination);
+/// @brief Logarithm of a quaternion
+/// @param q The quaternion as argument
+/// @note This opperation overrides the current value
+/// @return The input quaternion
+quat* lnQ_s(quat* restrict q);
+/// @brief Logarithm of a unit quaternion
+/// @param q The quaternion as argument
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* lnQ_Unit_(const quat* q, quat* restrict destination);
+/// @brief Logarithm of a unit quaternion
+/// @param q The quaternion as argument
+/// @note This opperation overrides the current value
+/// @return The input quaternion
+quat* lnQ_Unit_s(quat* restrict q);
+
+/// @brief Power of a quaternion
+/// @param q The quaternion in the base
+/// @param t The exponent
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat* powQ_(const quat* q, float t, quat* restrict destination);
+/// @brief Exponential of a quaternion
+/// @param q The quaternion in the base
+/// @param t The exponent
+/// @note This opperation overrides the current value
+/// @return The input quaternion
+quat* powQ_s(quat* restrict q, float t);
+
+/// @brief Spherical interpolation between quat a and quat b with factor t
+/// @param a The start position
+/// @param b The end position
+/// @param t The factor (Supposed in the range [0, 1])
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @note Represents shortest path on unit hypersphere between a and b with factor t
+/// @return The destination value
+quat* slerpQ_(const quat* a, const quat* b, float t, quat* restrict destination);
+/// @brief Spherical interpolation between quat a and quat b with factor t
+/// @param a The start position
+/// @param b The end position
+/// @param t The factor (Supposed in the range [0, 1])
+/// @note This opperation overrides the current value
+/// @note Represents shortest path on unit hypersphere between a and b with factor t
+/// @return The input quaternion
+quat* slerpQ_s(quat* restrict a, const quat* b, float t);
+/// @brief Spherical interpolation between unit quat a and unit quat b with factor t
+/// @param a The start position
+/// @param b The end position
+/// @param t The factor (Supposed in the range [0, 1])
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @note Represents shortest path on unit hypersphere between a and b with factor t
+/// @return The destination value
+quat* slerpQ_Unit_(const quat* a, const quat* b, float t, quat* restrict destination);
+/// @brief Spherical interpolation between unit quat a and unit quat b with factor t
+/// @param a The start position
+/// @param b The end position
+/// @param t The factor (Supposed in the range [0, 1])
+/// @note This opperation overrides the current value
+/// @note Represents shortest path on unit hypersphere between a and b with factor t
+/// @return The input quaternion
+quat* slerpQ_Unit_s(quat* restrict a, const quat* b, float t);
+/// @brief Fast approximate spherical interpolation between many pairs of unit quaternions
+/// @param a The start positions
+/// @param b The end positions
+/// @param t The factor of each pair (Supposed in the range [0, 1])
+/// @param count The number of pairs
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same approximation as slerpQ_Fast, in a branch-free loop vectorized by the compiler
+/// @return The destination value
+quat* slerpQ_Fast_Batch(const quat* a, const quat* b, const float* t, uint count, quat* restrict destination);
+
+/// @brief Convert quaternion to rotation vector
+/// @param q The quaternion to convert
+/// @param destination Where the result is stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* quatToVec3_Rot_(const quat* q, vec3* restrict destination);
+
+/// @brief Convert quaterion to euler angles
+/// @param q The quaternion to convert
+/// @param destination Where the result is stored
+/// @return The destination value
+/// @note Set destination to NULL for new value
+/// @note Angles are in (roll, pitch, yaw) order
+/// @note Base on this paper: https://pmc.ncbi.nlm.nih.gov/articles/PMC9648712/
+vec3* quatToVec3_Euler_(const quat* q, vec3* restrict destination);
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// PACKED QUATERNIONS ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// Packed quaternions use the "smallest three" encoding: the index of the largest component is stored
+// on 2 bits, the sign is canonicalized so that this component is positive (q and -q are the same rotation)
+// and the three others, which lie in [-1/sqrt(2), 1/sqrt(2)], are quantized. The largest one is rebuilt
+// from the unit length on decode.
+// With a quantization step d = sqrt(2) / (2^bits - 1), every component is within 1.5 * d of the original
+// and the rotation angle is off by at most 2 * sqrt(3) * d radians.
+
+/// @brief Unit quaternion packed on 32 bits (2 + 3 x 10 bits)
+/// @note Component error <= 2.1e-3, rotation error <= 0.28 degrees
+typedef uint32 quat32;
+/// @brief Unit quaternion packed on 48 bits (2 + 3 x 15 bits)
+/// @note Component error <= 6.5e-5, rotation error <= 0.009 degrees
+typedef struct PackedQuaternion48 { uint16 m[3]; } quat48;
+/// @brief Unit quaternion packed on 64 bits (2 + 3 x 20 bits)
+/// @note Component error <= 2.1e-6, rotation error <= 0.0003 degrees (close to float precision)
+typedef uint64 quat64;
+
+/// @brief Pack a unit quaternion on 32 bits
+/// @param q The quaternion (supposed unit)
+/// @return The packed quaternion
+quat32 quatPack32(quat q);
+/// @brief Unpack a quaternion packed on 32 bits
+/// @param p The packed quaternion
+/// @return The unit quaternion (with a positive largest component)
+quat quat32Unpack(quat32 p);
+/// @brief Pack a unit quaternion on 48 bits
+/// @param q The quaternion (supposed unit)
+/// @return The packed quaternion
+quat48 quatPack48(quat q);
+/// @brief Unpack a quaternion packed on 48 bits
+/// @param p The packed quaternion
+/// @return The unit quaternion (with a positive largest component)
+quat quat48Unpack(quat48 p);
+/// @brief Pack a unit quaternion on 64 bits
+/// @param q The quaternion (supposed unit)
+/// @return The packed quaternion
+quat64 quatPack64(quat q);
+/// @brief Unpack a quaternion packed on 64 bits
+/// @param p The packed quaternion
+/// @return The unit quaternion (with a positive largest component)
+quat quat64Unpack(quat64 p);
+
+/// @brief Pack many unit quaternions on 32 bits
+/// @param q The quaternions (supposed unit)
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat32* quatPack32_Batch(const quat* q, uint count, quat32* restrict destination);
+/// @brief Unpack many quaternions packed on 32 bits
+/// @param p The packed quaternions
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Branch-free loop, vectorized by the compiler
+/// @return The destination value
+quat* quat32Unpack_Batch(const quat32* p, uint count, quat* restrict destination);
+/// @brief Pack many unit quaternions on 48 bits
+/// @param q The quaternions (supposed unit)
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat48* quatPack48_Batch(const quat* q, uint count, quat48* restrict destination);
+/// @brief Unpack many quaternions packed on 48 bits
+/// @param p The packed quaternions
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Branch-free loop, vectorized by the compiler
+/// @return The destination value
+quat* quat48Unpack_Batch(const quat48* p, uint count, quat* restrict destination);
+/// @brief Pack many unit quaternions on 64 bits
+/// @param q The quaternions (supposed unit)
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+quat64* quatPack64_Batch(const quat* q, uint count, quat64* restrict destination);
+/// @brief Unpack many quaternions packed on 64 bits
+/// @param p The packed quaternions
+/// @param count The number of quaternions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Branch-free loop, vectorized by the compiler
+/// @return The destination value
+quat* quat64Unpack_Batch(const quat64* p, uint count, quat* restrict destination);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,557 @@
+#include "random.h"
+
+#include <stdlib.h>
+#include <math.h>
+#include "../utils/inout.h"
+
+#define PCG32_MULTIPLIER 6364136223846793005ull
+
+rand_state createRandState(uint64 seed, uint64 stream) {
+    rand_state new = {.state = 0, .increment = stream << 1u | 1u};
+    randU32(&new);
+    new.state += seed;
+    randU32(&new);
+    return new;
+}
+
+void randAdvance(rand_state* state, uint64 delta) {
+    // Compose the LCG step with itself by squaring: state' = mult * state + plus after delta steps
+    uint64 mult = 1, plus = 0;
+    uint64 stepMult = PCG32_MULTIPLIER, stepPlus = state->increment;
+    while (delta) {
+        if (delta & 1u) {
+            mult *= stepMult;
+            plus = plus * stepMult + stepPlus;
+        }
+        stepPlus *= stepMult + 1;
+        stepMult *= stepMult;
+        delta >>= 1u;
+    }
+    state->state = mult * state->state + plus;
+}
+
+// Number of xoshiro128** generators run side by side by the batches
+#define RAND_LANES 16
+// Below this many values, the batches simply draw from the state
+#define RAND_BATCH_MIN (4 * RAND_LANES)
+// Values converted to floats at a time, from a block on the stack
+#define RAND_FLOAT_BLOCK 256
+
+static void* randAlloc(size_t size) {
+    void* new = malloc(size);
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate random values!");
+    return new;
+}
+
+static inline uint32 randRotl(uint32 x, uint32 k) {
+    return (x << k) | (x >> (32u - k));
+}
+
+// Lanes of xoshiro128** generators
+typedef struct RandomLanes {
+    uint32 s0[RAND_LANES], s1[RAND_LANES], s2[RAND_LANES], s3[RAND_LANES];
+} rand_lanes;
+
+static void randLanesSeed(rand_lanes* l, rand_state* state) {
+    for (uint i = 0; i < RAND_LANES; i++) {
+        l->s0[i] = randU32(state); l->s1[i] = randU32(state); l->s2[i] = randU32(state); l->s3[i] = randU32(state);
+        l->s0[i] |= !(l->s0[i] | l->s1[i] | l->s2[i] | l->s3[i]); // xoshiro must not start from 0
+    }
+}
+// Write count >= RAND_LANES values, one per lane at each step
+static void randLanesNext(rand_lanes* restrict l, uint count, uint32* restrict c) {
+    uint32 s0[RAND_LANES], s1[RAND_LANES], s2[RAND_LANES], s3[RAND_LANES];
+    for (uint i = 0; i < RAND_LANES; i++) { s0[i] = l->s0[i]; s1[i] = l->s1[i]; s2[i] = l->s2[i]; s3[i] = l->s3[i]; }
+
+    // The last step may overlap the previous one instead of needing a tail
+    for (uint start = 0; start < count; start += RAND_LANES) {
+        if (start + RAND_LANES > count) start = count - RAND_LANES;
+        uint32* restrict out = c + start;
+        for (uint i = 0; i < RAND_LANES; i++) {
+            out[i] = randRotl(s1[i] * 5u, 7u) * 9u;
+            const uint32 t = s1[i] << 9u;
+            s2[i] ^= s0[i];
+            s3[i] ^= s1[i];
+            s1[i] ^= s2[i];
+            s0[i] ^= s3[i];
+            s2[i] ^= t;
+            s3[i] = randRotl(s3[i], 11u);
+        }
+    }
+
+    for (uint i = 0; i < RAND_LANES; i++) { l->s0[i] = s0[i]; l->s1[i] = s1[i]; l->s2[i] = s2[i]; l->s3[i] = s3[i]; }
+}
+
+// Fill with raw 32 bit values
+static void randFillRaw(rand_state* state, uint count, uint32* restrict c) {
+    if (count < RAND_BATCH_MIN) {
+        for (uint i = 0; i < count; i++) c[i] = randU32(state);
+        return;
+    }
+    rand_lanes l;
+    randLanesSeed(&l, state);
+    randLanesNext(&l, count, c);
+}
+// Fill with floats in [0, 1) (top 24 bits, like randFloat)
+// The raw values go through a local block, as the floats must not be written as integers
+static void randFillFloat(rand_state* state, uint count, float* restrict c) {
+    uint32 raw[RAND_FLOAT_BLOCK];
+    if (count < RAND_BATCH_MIN) {
+        for (uint i = 0; i < count; i++) raw[i] = randU32(state);
+        for (uint i = 0; i < count; i++) c[i] = (float)(int32)(raw[i] >> 8) * (1.0f / 16777216.0f);
+        return;
+    }
+    rand_lanes l;
+    randLanesSeed(&l, state);
+    for (uint start = 0; start < count; start += RAND_FLOAT_BLOCK) {
+        const uint n = count - start < RAND_FLOAT_BLOCK ? count - start : RAND_FLOAT_BLOCK;
+        randLanesNext(&l, n < RAND_LANES ? RAND_LANES : n, raw);
+        // Converted as signed (exact below 2^24), which every SIMD instruction set supports
+        float* restrict out = c + start;
+        for (uint i = 0; i < n; i++) out[i] = (float)(int32)(raw[i] >> 8) * (1.0f / 16777216.0f);
+    }
+}
+
+uint32* randU32_Batch(rand_state* state, uint count, uint32* restrict c) {
+    if (!c) c = randAlloc(sizeof(uint32) * count);
+    randFillRaw(state, count, c);
+    return c;
+}
+float* randFloat_Batch(rand_state* state, uint count, float* restrict c) {
+    if (!c) c = randAlloc(sizeof(float) * count);
+    randFillFloat(state, count, c);
+    return c;
+}
+vec2* rand2_Batch(rand_state* state, uint count, vec2* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec2) * count);
+    randFillFloat(state, 2 * count, (float*)c);
+    return c;
+}
+vec3* rand3_Batch(rand_state* state, uint count, vec3* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec3) * count);
+    randFillFloat(state, 3 * count, (float*)c);
+    return c;
+}
+vec4* rand4_Batch(rand_state* state, uint count, vec4* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec4) * count);
+    randFillFloat(state, 4 * count, (float*)c);
+    return c;
+}
+
+static uint64 randNextStream = 0;
+static _Thread_local rand_state randThreadState;
+static _Thread_local bool randThreadReady = false;
+
+rand_state* SL_getRandState() {
+    if (!randThreadReady) {
+        randThreadState = createRandState(0, __atomic_fetch_add(&randNextStream, 1, __ATOMIC_RELAXED));
+        randThreadReady = true;
+    }
+    return &randThreadState;
+}
+
+
+
+///// DISTRIBUTIONS
+
+// Number of raw values drawn from the lanes at once by the sampler batches
+#define RAND_BLOCK 256
+
+// Transform raw values into count samples (perValue raw values each) stored in out
+typedef void (*rand_transform)(rand_state* state, const uint32* restrict raw, uint count, void* restrict out);
+
+// Run a transform over blocks of raw values from lanes seeded by the state (or drawn from it for small batches)
+static void randBlocks(rand_state* state, uint count, uint perValue, size_t valueSize, rand_transform transform, void* out) {
+    uint32 raw[RAND_BLOCK];
+    if (count * perValue < RAND_BATCH_MIN) {
+        for (uint i = 0; i < count * perValue; i++) raw[i] = randU32(state);
+        transform(state, raw, count, out);
+        return;
+    }
+
+    rand_lanes l;
+    randLanesSeed(&l, state);
+    const uint block = RAND_BLOCK / perValue;
+    for (uint start = 0; start < count; start += block) {
+        const uint size = count - start < block ? count - start : block;
+        randLanesNext(&l, RAND_BLOCK, raw);
+        transform(state, raw, size, (uint8*)out + valueSize * start);
+    }
+}
+
+// Raw value to float in [0, 1[ (top 24 bits, converted as signed for SIMD) and in ]0, 1]
+static inline float randRawToFloat(uint32 r) {
+    return (float)(int32)(r >> 8) * (1.0f / 16777216.0f);
+}
+static inline float randRawToOpenFloat(uint32 r) {
+    return (float)(int32)((r >> 8) + 1) * (1.0f / 16777216.0f);
+}
+
+// Cosine and sine of a fraction of a turn in [0, 1[, branch-free (error below 1e-6)
+static inline void randSinCos(float turns, float* restrict s, float* restrict c) {
+    // Quarter of the turn, then Taylor series on [0, pi/2[
+    const float q = turns * 4.0f;
+    const int k = (int)q;
+    const float a = (q - (float)k) * 1.57079633f, a2 = a * a;
+    const float sa = a * (1.0f + a2 * (-1.0f / 6.0f + a2 * (1.0f / 120.0f + a2 * (-1.0f / 5040.0f + a2 * (1.0f / 362880.0f + a2 * (-1.0f / 39916800.0f))))));
+    const float ca = 1.0f + a2 * (-0.5f + a2 * (1.0f / 24.0f + a2 * (-1.0f / 720.0f + a2 * (1.0f / 40320.0f + a2 * (-1.0f / 3628800.0f + a2 * (1.0f / 479001600.0f))))));
+
+    // Rotate by k quarter turns, (c, s) -> (-s, c), with bit masks rather than branches
+    union { float f; uint32 i; } uc = {ca}, us = {sa}, rc, rs;
+    const uint32 odd = -(uint32)(k & 1), flip = (uint32)(k & 2) << 30;
+    rc.i = ((us.i ^ 0x80000000u) & odd) | (uc.i & ~odd);
+    rs.i = (uc.i & odd) | (us.i & ~odd);
+    *c = (union { uint32 i; float f; }) {rc.i ^ flip}.f;
+    *s = (union { uint32 i; float f; }) {rs.i ^ flip}.f;
+}
+
+// Ziggurat tables (Marsaglia & Tsang): 128 layers for the normal, 256 for the exponential.
+// K holds the 24 bit thresholds under which a sample lies inside its layer, W the widths, F the densities.
+static const uint32 randNormalK[128] = {
+    15555140u, 0u, 12590646u, 14272655u, 14988941u, 15384586u, 15635011u, 15807563u,
+    15933579u, 16029596u, 16105157u, 16166149u, 16216401u, 16258510u, 16294297u, 16325080u,
+    16351833u, 16375293u, 16396028u, 16414481u, 16431004u, 16445882u, 16459345u, 16471580u,
+    16482746u, 16492973u, 16502371u, 16511033u, 16519041u, 16526461u, 16533355u, 16539771u,
+    16545757u, 16551350u, 16556586u, 16561495u, 16566103u, 16570436u, 16574514u, 16578356u,
+    16581979u, 16585400u, 16588632u, 16591687u, 16594578u, 16597313u, 16599904u, 16602357u,
+    16604681u, 16606884u, 16608971u, 16610948u, 16612821u, 16614596u, 16616275u, 16617864u,
+    16619366u, 16620785u, 16622124u, 16623386u, 16624574u, 16625689u, 16626734u, 16627712u,
+    16628623u, 16629469u, 16630252u, 16630973u, 16631633u, 16632232u, 16632772u, 16633253u,
+    16633676u, 16634040u, 16634345u, 16634592u, 16634780u, 16634909u, 16634978u, 16634986u,
+    16634933u, 16634816u, 16634636u, 16634389u, 16634074u, 16633688u, 16633230u, 16632697u,
+    16632084u, 16631389u, 16630608u, 16629736u, 16628767u, 16627697u, 16626519u, 16625225u,
+    16623807u, 16622256u, 16620562u, 16618713u, 16616695u, 16614493u, 16612090u, 16609464u,
+    16606592u, 16603448u, 16599998u, 16596205u, 16592024u, 16587401u, 16582272u, 16576558u,
+    16570162u, 16562964u, 16554811u, 16545510u, 16534808u, 16522367u, 16507732u, 16490264u,
+    16469044u, 16442689u, 16409025u, 16364393u, 16302110u, 16208407u, 16049218u, 15707337u
+};
+static const float randNormalW[128] = {
+    2.213171868e-7f, 1.623158841e-8f, 2.162882275e-8f, 2.542424121e-8f, 2.845751269e-8f, 3.103351824e-8f,
+    3.330064883e-8f, 3.534334555e-8f, 3.721467241e-8f, 3.895036213e-8f, 4.057573787e-8f, 4.210946627e-8f,
+    4.356574480e-8f, 4.495565083e-8f, 4.628801274e-8f, 4.756999377e-8f, 4.880749623e-8f, 5.000544872e-8f,
+    5.116801519e-8f, 5.229875023e-8f, 5.340071634e-8f, 5.447657412e-8f, 5.552865247e-8f, 5.655900392e-8f,
+    5.756944891e-8f, 5.856161139e-8f, 5.953694782e-8f, 6.049677105e-8f, 6.144227004e-8f, 6.237452631e-8f,
+    6.329452775e-8f, 6.420318037e-8f, 6.510131818e-8f, 6.598971173e-8f, 6.686907545e-8f, 6.774007392e-8f,
+    6.860332740e-8f, 6.945941664e-8f, 7.030888704e-8f, 7.115225243e-8f, 7.198999825e-8f, 7.282258454e-8f,
+    7.365044852e-8f, 7.447400687e-8f, 7.529365787e-8f, 7.610978327e-8f, 7.692274999e-8f, 7.773291171e-8f,
+    7.854061027e-8f, 7.934617696e-8f, 8.014993380e-8f, 8.095219459e-8f, 8.175326600e-8f, 8.255344854e-8f,
+    8.335303748e-8f, 8.415232375e-8f, 8.495159474e-8f, 8.575113515e-8f, 8.655122774e-8f, 8.735215410e-8f,
+    8.815419537e-8f, 8.895763301e-8f, 8.976274948e-8f, 9.056982903e-8f, 9.137915836e-8f, 9.219102739e-8f,
+    9.300573005e-8f, 9.382356501e-8f, 9.464483648e-8f, 9.546985508e-8f, 9.629893869e-8f, 9.713241336e-8f,
+    9.797061425e-8f, 9.881388670e-8f, 9.966258729e-8f, 1.005170850e-7f, 1.013777625e-7f, 1.022450173e-7f,
+    1.031192637e-7f, 1.040009337e-7f, 1.048904791e-7f, 1.057883737e-7f, 1.066951145e-7f, 1.076112249e-7f,
+    1.085372565e-7f, 1.094737923e-7f, 1.104214496e-7f, 1.113808835e-7f, 1.123527906e-7f, 1.133379133e-7f,
+    1.143370450e-7f, 1.153510349e-7f, 1.163807946e-7f, 1.174273050e-7f, 1.184916242e-7f, 1.195748967e-7f,
+    1.206783636e-7f, 1.218033753e-7f, 1.229514047e-7f, 1.241240643e-7f, 1.253231248e-7f, 1.265505379e-7f,
+    1.278084625e-7f, 1.290992972e-7f, 1.304257174e-7f, 1.317907219e-7f, 1.331976888e-7f, 1.346504434e-7f,
+    1.361533439e-7f, 1.377113869e-7f, 1.393303419e-7f, 1.410169226e-7f, 1.427790092e-7f, 1.446259407e-7f,
+    1.465689050e-7f, 1.486214711e-7f, 1.508003278e-7f, 1.531263367e-7f, 1.556260734e-7f, 1.583341605e-7f,
+    1.612969382e-7f, 1.645785196e-7f, 1.682713837e-7f, 1.725163464e-7f, 1.775441320e-7f, 1.837747609e-7f,
+    1.921108356e-7f, 2.051961336e-7f
+};
+static const float randNormalF[128] = {
+    1.000000000e+0f, 9.635996931e-1f, 9.362826817e-1f, 9.130436480e-1f, 8.922816508e-1f, 8.732430489e-1f,
+    8.555006079e-1f, 8.387836053e-1f, 8.229072114e-1f, 8.077382947e-1f, 7.931770118e-1f, 7.791460859e-1f,
+    7.655841739e-1f, 7.524415592e-1f, 7.396772437e-1f, 7.272569183e-1f, 7.151515074e-1f, 7.033360990e-1f,
+    6.917891434e-1f, 6.804918410e-1f, 6.694276673e-1f, 6.585820001e-1f, 6.479418211e-1f, 6.374954773e-1f,
+    6.272324852e-1f, 6.171433708e-1f, 6.072195366e-1f, 5.974531509e-1f, 5.878370544e-1f, 5.783646811e-1f,
+    5.690299911e-1f, 5.598274127e-1f, 5.507517931e-1f, 5.417983550e-1f, 5.329626594e-1f, 5.242405727e-1f,
+    5.156282382e-1f, 5.071220511e-1f, 4.987186355e-1f, 4.904148253e-1f, 4.822076463e-1f, 4.740943007e-1f,
+    4.660721527e-1f, 4.581387163e-1f, 4.502916437e-1f, 4.425287153e-1f, 4.348478302e-1f, 4.272469983e-1f,
+    4.197243320e-1f, 4.122780401e-1f, 4.049064208e-1f, 3.976078565e-1f, 3.903808082e-1f, 3.832238111e-1f,
+    3.761354695e-1f, 3.691144537e-1f, 3.621594954e-1f, 3.552693848e-1f, 3.484429675e-1f, 3.416791412e-1f,
+    3.349768533e-1f, 3.283350984e-1f, 3.217529159e-1f, 3.152293881e-1f, 3.087636380e-1f, 3.023548278e-1f,
+    2.960021568e-1f, 2.897048604e-1f, 2.834622082e-1f, 2.772735029e-1f, 2.711380791e-1f, 2.650553023e-1f,
+    2.590245674e-1f, 2.530452985e-1f, 2.471169475e-1f, 2.412389935e-1f, 2.354109423e-1f, 2.296323252e-1f,
+    2.239026994e-1f, 2.182216466e-1f, 2.125887731e-1f, 2.070037094e-1f, 2.014661101e-1f, 1.959756531e-1f,
+    1.905320403e-1f, 1.851349970e-1f, 1.797842721e-1f, 1.744796383e-1f, 1.692208922e-1f, 1.640078547e-1f,
+    1.588403711e-1f, 1.537183122e-1f, 1.486415742e-1f, 1.436100801e-1f, 1.386237800e-1f, 1.336826526e-1f,
+    1.287867062e-1f, 1.239359802e-1f, 1.191305467e-1f, 1.143705124e-1f, 1.096560210e-1f, 1.049872554e-1f,
+    1.003644410e-1f, 9.578784912e-2f, 9.125780083e-2f, 8.677467189e-2f, 8.233889824e-2f, 7.795098251e-2f,
+    7.361150188e-2f, 6.932111739e-2f, 6.508058521e-2f, 6.089077035e-2f, 5.675266348e-2f, 5.266740190e-2f,
+    4.863629586e-2f, 4.466086220e-2f, 4.074286807e-2f, 3.688438879e-2f, 3.308788615e-2f, 2.935631744e-2f,
+    2.569329194e-2f, 2.210330462e-2f, 1.859210274e-2f, 1.516729801e-2f, 1.183947866e-2f, 8.624484413e-3f,
+    5.548995221e-3f, 2.669629084e-3f
+};
+static const uint32 randExpK[256] = {
+    14848161u, 0u, 10218206u, 12810156u, 13950393u, 14584127u, 14985448u, 15261681u,
+    15463134u, 15616422u, 15736910u, 15834075u, 15914072u, 15981072u, 16037997u, 16086957u,
+    16129512u, 16166839u, 16199845u, 16229238u, 16255579u, 16279320u, 16300827u, 16320400u,
+    16338288u, 16354700u, 16369810u, 16383767u, 16396697u, 16408709u, 16419898u, 16430344u,
+    16440118u, 16449284u, 16457894u, 16465999u, 16473641u, 16480857u, 16487683u, 16494148u,
+    16500280u, 16506104u, 16511642u, 16516913u, 16521937u, 16526731u, 16531308u, 16535683u,
+    16539869u, 16543878u, 16547720u, 16551404u, 16554941u, 16558338u, 16561603u, 16564744u,
+    16567767u, 16570677u, 16573482u, 16576186u, 16578795u, 16581312u, 16583743u, 16586091u,
+    16588360u, 16590554u, 16592677u, 16594730u, 16596718u, 16598643u, 16600508u, 16602315u,
+    16604066u, 16605765u, 16607412u, 16609009u, 16610560u, 16612065u, 16613526u, 16614944u,
+    16616322u, 16617660u, 16618961u, 16620225u, 16621453u, 16622647u, 16623807u, 16624936u,
+    16626033u, 16627100u, 16628137u, 16629147u, 16630128u, 16631083u, 16632012u, 16632916u,
+    16633795u, 16634649u, 16635481u, 16636290u, 16637076u, 16637841u, 16638585u, 16639309u,
+    16640012u, 16640695u, 16641360u, 16642005u, 16642632u, 16643242u, 16643833u, 16644407u,
+    16644964u, 16645505u, 16646029u, 16646538u, 16647030u, 16647507u, 16647969u, 16648415u,
+    16648847u, 16649264u, 16649667u, 16650056u, 16650431u, 16650792u, 16651139u, 16651473u,
+    16651793u, 16652101u, 16652395u, 16652676u, 16652944u, 16653199u, 16653442u, 16653672u,
+    16653890u, 16654095u, 16654287u, 16654467u, 16654635u, 16654791u, 16654934u, 16655065u,
+    16655183u, 16655290u, 16655384u, 16655465u, 16655535u, 16655592u, 16655636u, 16655668u,
+    16655687u, 16655694u, 16655688u, 16655669u, 16655637u, 16655592u, 16655534u, 16655462u,
+    16655377u, 16655279u, 16655166u, 16655040u, 16654899u, 16654744u, 16654574u, 16654389u,
+    16654189u, 16653974u, 16653742u, 16653495u, 16653232u, 16652951u, 16652654u, 16652338u,
+    16652005u, 16651654u, 16651284u, 16650894u, 16650485u, 16650055u, 16649604u, 16649132u,
+    16648637u, 16648119u, 16647578u, 16647012u, 16646421u, 16645803u, 16645158u, 16644486u,
+    16643784u, 16643052u, 16642288u, 16641491u, 16640661u, 16639795u, 16638891u, 16637949u,
+    16636967u, 16635942u, 16634873u, 16633757u, 16632593u, 16631377u, 16630107u, 16628780u,
+    16627394u, 16625943u, 16624426u, 16622837u, 16621174u, 16619430u, 16617601u, 16615681u,
+    16613665u, 16611545u, 16609314u, 16606964u, 16604487u, 16601871u, 16599107u, 16596181u,
+    16593081u, 16589790u, 16586292u, 16582567u, 16578593u, 16574345u, 16569794u, 16564906u,
+    16559645u, 16553965u, 16547814u, 16541132u, 16533847u, 16525871u, 16517102u, 16507411u,
+    16496645u, 16484608u, 16471057u, 16455680u, 16438068u, 16417682u, 16393787u, 16365357u,
+    16330913u, 16288240u, 16233847u, 16161893u, 16061744u, 15911694u, 15658929u, 15129198u
+};
+static const float randExpW[256] = {
+    5.183885974e-7f, 3.805885542e-9f, 6.248862002e-9f, 8.184014615e-9f, 9.842373286e-9f, 1.132242022e-8f,
+    1.267620985e-8f, 1.393499869e-8f, 1.511921664e-8f, 1.624305162e-8f, 1.731681558e-8f, 1.834827391e-8f,
+    1.934344274e-8f, 2.030709273e-8f, 2.124308111e-8f, 2.215457829e-8f, 2.304422724e-8f, 2.391425841e-8f,
+    2.476657448e-8f, 2.560281397e-8f, 2.642439998e-8f, 2.723257786e-8f, 2.802844495e-8f, 2.881297419e-8f,
+    2.958703312e-8f, 3.035139933e-8f, 3.110677311e-8f, 3.185378797e-8f, 3.259301932e-8f, 3.332499179e-8f,
+    3.405018547e-8f, 3.476904111e-8f, 3.548196461e-8f, 3.618933091e-8f, 3.689148732e-8f, 3.758875638e-8f,
+    3.828143838e-8f, 3.896981358e-8f, 3.965414413e-8f, 4.033467579e-8f, 4.101163940e-8f, 4.168525226e-8f,
+    4.235571926e-8f, 4.302323403e-8f, 4.368797979e-8f, 4.435013029e-8f, 4.500985051e-8f, 4.566729741e-8f,
+    4.632262050e-8f, 4.697596245e-8f, 4.762745961e-8f, 4.827724243e-8f, 4.892543593e-8f, 4.957216011e-8f,
+    5.021753024e-8f, 5.086165725e-8f, 5.150464802e-8f, 5.214660563e-8f, 5.278762965e-8f, 5.342781637e-8f,
+    5.406725900e-8f, 5.470604790e-8f, 5.534427075e-8f, 5.598201275e-8f, 5.661935674e-8f, 5.725638340e-8f,
+    5.789317137e-8f, 5.852979738e-8f, 5.916633639e-8f, 5.980286169e-8f, 6.043944502e-8f, 6.107615668e-8f,
+    6.171306561e-8f, 6.235023951e-8f, 6.298774490e-8f, 6.362564722e-8f, 6.426401088e-8f, 6.490289938e-8f,
+    6.554237536e-8f, 6.618250064e-8f, 6.682333635e-8f, 6.746494290e-8f, 6.810738013e-8f, 6.875070731e-8f,
+    6.939498321e-8f, 7.004026617e-8f, 7.068661412e-8f, 7.133408464e-8f, 7.198273500e-8f, 7.263262225e-8f,
+    7.328380321e-8f, 7.393633451e-8f, 7.459027269e-8f, 7.524567420e-8f, 7.590259542e-8f, 7.656109275e-8f,
+    7.722122262e-8f, 7.788304153e-8f, 7.854660607e-8f, 7.921197302e-8f, 7.987919930e-8f, 8.054834206e-8f,
+    8.121945873e-8f, 8.189260699e-8f, 8.256784488e-8f, 8.324523079e-8f, 8.392482350e-8f, 8.460668223e-8f,
+    8.529086667e-8f, 8.597743702e-8f, 8.666645401e-8f, 8.735797895e-8f, 8.805207379e-8f, 8.874880108e-8f,
+    8.944822412e-8f, 9.015040689e-8f, 9.085541417e-8f, 9.156331152e-8f, 9.227416537e-8f, 9.298804304e-8f,
+    9.370501276e-8f, 9.442514375e-8f, 9.514850624e-8f, 9.587517153e-8f, 9.660521202e-8f, 9.733870128e-8f,
+    9.807571407e-8f, 9.881632641e-8f, 9.956061564e-8f, 1.003086604e-7f, 1.010605409e-7f, 1.018163387e-7f,
+    1.025761367e-7f, 1.033400199e-7f, 1.041080744e-7f, 1.048803884e-7f, 1.056570518e-7f, 1.064381561e-7f,
+    1.072237951e-7f, 1.080140643e-7f, 1.088090616e-7f, 1.096088867e-7f, 1.104136417e-7f, 1.112234311e-7f,
+    1.120383617e-7f, 1.128585430e-7f, 1.136840868e-7f, 1.145151079e-7f, 1.153517238e-7f, 1.161940550e-7f,
+    1.170422249e-7f, 1.178963602e-7f, 1.187565910e-7f, 1.196230506e-7f, 1.204958760e-7f, 1.213752079e-7f,
+    1.222611910e-7f, 1.231539738e-7f, 1.240537092e-7f, 1.249605543e-7f, 1.258746711e-7f, 1.267962260e-7f,
+    1.277253905e-7f, 1.286623414e-7f, 1.296072608e-7f, 1.305603365e-7f, 1.315217622e-7f, 1.324917378e-7f,
+    1.334704696e-7f, 1.344581708e-7f, 1.354550615e-7f, 1.364613694e-7f, 1.374773299e-7f, 1.385031864e-7f,
+    1.395391910e-7f, 1.405856048e-7f, 1.416426981e-7f, 1.427107513e-7f, 1.437900551e-7f, 1.448809111e-7f,
+    1.459836324e-7f, 1.470985443e-7f, 1.482259847e-7f, 1.493663051e-7f, 1.505198711e-7f, 1.516870634e-7f,
+    1.528682784e-7f, 1.540639293e-7f, 1.552744471e-7f, 1.565002815e-7f, 1.577419021e-7f, 1.589997995e-7f,
+    1.602744871e-7f, 1.615665016e-7f, 1.628764055e-7f, 1.642047880e-7f, 1.655522672e-7f, 1.669194919e-7f,
+    1.683071436e-7f, 1.697159389e-7f, 1.711466320e-7f, 1.726000171e-7f, 1.740769319e-7f, 1.755782601e-7f,
+    1.771049356e-7f, 1.786579460e-7f, 1.802383366e-7f, 1.818472157e-7f, 1.834857592e-7f, 1.851552166e-7f,
+    1.868569170e-7f, 1.885922765e-7f, 1.903628053e-7f, 1.921701172e-7f, 1.940159386e-7f, 1.959021194e-7f,
+    1.978306455e-7f, 1.998036522e-7f, 2.018234397e-7f, 2.038924907e-7f, 2.060134900e-7f, 2.081893477e-7f,
+    2.104232245e-7f, 2.127185622e-7f, 2.150791176e-7f, 2.175090024e-7f, 2.200127298e-7f, 2.225952681e-7f,
+    2.252621050e-7f, 2.280193221e-7f, 2.308736843e-7f, 2.338327468e-7f, 2.369049827e-7f, 2.400999394e-7f,
+    2.434284276e-7f, 2.469027558e-7f, 2.505370208e-7f, 2.543474722e-7f, 2.583529759e-7f, 2.625756081e-7f,
+    2.670414297e-7f, 2.717815078e-7f, 2.768332890e-7f, 2.822424767e-7f, 2.880656565e-7f, 2.943740538e-7f,
+    3.012590700e-7f, 3.088407088e-7f, 3.172809187e-7f, 3.268057482e-7f, 3.377443652e-7f, 3.506031225e-7f,
+    3.662207523e-7f, 3.861414488e-7f, 4.137178439e-7f, 4.587839526e-7f
+};
+static const float randExpF[256] = {
+    1.000000000e+0f, 9.381436809e-1f, 9.004699299e-1f, 8.717043324e-1f, 8.477855006e-1f, 8.269932966e-1f,
+    8.084216515e-1f, 7.915276370e-1f, 7.759568520e-1f, 7.614633888e-1f, 7.478686220e-1f, 7.350380924e-1f,
+    7.228676596e-1f, 7.112747608e-1f, 7.001926551e-1f, 6.895664961e-1f, 6.793505723e-1f, 6.695063167e-1f,
+    6.600008411e-1f, 6.508058334e-1f, 6.418967164e-1f, 6.332519942e-1f, 6.248527387e-1f, 6.166821809e-1f,
+    6.087253821e-1f, 6.009689664e-1f, 5.934009017e-1f, 5.860103185e-1f, 5.787873586e-1f, 5.717230487e-1f,
+    5.648091929e-1f, 5.580382823e-1f, 5.514034165e-1f, 5.448982377e-1f, 5.385168720e-1f, 5.322538803e-1f,
+    5.261042140e-1f, 5.200631774e-1f, 5.141263938e-1f, 5.082897764e-1f, 5.025495018e-1f, 4.969019872e-1f,
+    4.913438696e-1f, 4.858719873e-1f, 4.804833639e-1f, 4.751751930e-1f, 4.699448253e-1f, 4.647897563e-1f,
+    4.597076156e-1f, 4.546961575e-1f, 4.497532512e-1f, 4.448768734e-1f, 4.400651008e-1f, 4.353161032e-1f,
+    4.306281373e-1f, 4.259995411e-1f, 4.214287290e-1f, 4.169141864e-1f, 4.124544660e-1f, 4.080481832e-1f,
+    4.036940125e-1f, 3.993906845e-1f, 3.951369818e-1f, 3.909317370e-1f, 3.867738291e-1f, 3.826621815e-1f,
+    3.785957594e-1f, 3.745735676e-1f, 3.705946484e-1f, 3.666580798e-1f, 3.627629734e-1f, 3.589084729e-1f,
+    3.550937529e-1f, 3.513180164e-1f, 3.475804946e-1f, 3.438804447e-1f, 3.402171491e-1f, 3.365899140e-1f,
+    3.329980688e-1f, 3.294409643e-1f, 3.259179724e-1f, 3.224284850e-1f, 3.189719128e-1f, 3.155476852e-1f,
+    3.121552488e-1f, 3.087940669e-1f, 3.054636192e-1f, 3.021634007e-1f, 2.988929210e-1f, 2.956517043e-1f,
+    2.924392882e-1f, 2.892552235e-1f, 2.860990737e-1f, 2.829704145e-1f, 2.798688332e-1f, 2.767939284e-1f,
+    2.737453097e-1f, 2.707225968e-1f, 2.677254199e-1f, 2.647534188e-1f, 2.618062427e-1f, 2.588835497e-1f,
+    2.559850070e-1f, 2.531102900e-1f, 2.502590824e-1f, 2.474310757e-1f, 2.446259691e-1f, 2.418434694e-1f,
+    2.390832903e-1f, 2.363451525e-1f, 2.336287834e-1f, 2.309339172e-1f, 2.282602939e-1f, 2.256076601e-1f,
+    2.229757681e-1f, 2.203643758e-1f, 2.177732471e-1f, 2.152021511e-1f, 2.126508620e-1f, 2.101191594e-1f,
+    2.076068277e-1f, 2.051136563e-1f, 2.026394391e-1f, 2.001839747e-1f, 1.977470661e-1f, 1.953285207e-1f,
+    1.929281500e-1f, 1.905457697e-1f, 1.881811994e-1f, 1.858342628e-1f, 1.835047871e-1f, 1.811926035e-1f,
+    1.788975466e-1f, 1.766194546e-1f, 1.743581692e-1f, 1.721135353e-1f, 1.698854013e-1f, 1.676736186e-1f,
+    1.654780419e-1f, 1.632985288e-1f, 1.611349399e-1f, 1.589871390e-1f, 1.568549924e-1f, 1.547383694e-1f,
+    1.526371420e-1f, 1.505511850e-1f, 1.484803756e-1f, 1.464245939e-1f, 1.443837222e-1f, 1.423576454e-1f,
+    1.403462511e-1f, 1.383494289e-1f, 1.363670709e-1f, 1.343990717e-1f, 1.324453279e-1f, 1.305057385e-1f,
+    1.285802045e-1f, 1.266686294e-1f, 1.247709186e-1f, 1.228869795e-1f, 1.210167218e-1f, 1.191600572e-1f,
+    1.173168992e-1f, 1.154871636e-1f, 1.136707679e-1f, 1.118676317e-1f, 1.100776764e-1f, 1.083008255e-1f,
+    1.065370041e-1f, 1.047861393e-1f, 1.030481602e-1f, 1.013229974e-1f, 9.961058367e-2f, 9.791085331e-2f,
+    9.622374255e-2f, 9.454918938e-2f, 9.288713356e-2f, 9.123751663e-2f, 8.960028191e-2f, 8.797537447e-2f,
+    8.636274114e-2f, 8.476233053e-2f, 8.317409301e-2f, 8.159798071e-2f, 8.003394754e-2f, 7.848194920e-2f,
+    7.694194317e-2f, 7.541388873e-2f, 7.389774699e-2f, 7.239348088e-2f, 7.090105516e-2f, 6.942043650e-2f,
+    6.795159342e-2f, 6.649449639e-2f, 6.504911779e-2f, 6.361543200e-2f, 6.219341541e-2f, 6.078304645e-2f,
+    5.938430563e-2f, 5.799717563e-2f, 5.662164128e-2f, 5.525768968e-2f, 5.390531020e-2f, 5.256449459e-2f,
+    5.123523706e-2f, 4.991753428e-2f, 4.861138557e-2f, 4.731679291e-2f, 4.603376108e-2f, 4.476229773e-2f,
+    4.350241357e-2f, 4.225412241e-2f, 4.101744138e-2f, 3.979239102e-2f, 3.857899550e-2f, 3.737728277e-2f,
+    3.618728478e-2f, 3.500903770e-2f, 3.384258215e-2f, 3.268796351e-2f, 3.154523217e-2f, 3.041444391e-2f,
+    2.929566022e-2f, 2.818894876e-2f, 2.709438378e-2f, 2.601204665e-2f, 2.494202642e-2f, 2.388442051e-2f,
+    2.283933541e-2f, 2.180688750e-2f, 2.078720407e-2f, 1.978042434e-2f, 1.878670074e-2f, 1.780620041e-2f,
+    1.683910683e-2f, 1.588562184e-2f, 1.494596801e-2f, 1.402039140e-2f, 1.310916493e-2f, 1.221259243e-2f,
+    1.133101360e-2f, 1.046481018e-2f, 9.614413643e-3f, 8.780314986e-3f, 7.963077438e-3f, 7.163353184e-3f,
+    6.381905937e-3f, 5.619642207e-3f, 4.877655984e-3f, 4.157295121e-3f, 3.460264778e-3f, 2.788798794e-3f,
+    2.145967744e-3f, 1.536299780e-3f, 9.672692823e-4f, 4.541343538e-4f
+};
+
+// Start of the normal's tail
+#define RAND_NORMAL_R 3.44261986f
+// Start of the exponential's tail
+#define RAND_EXP_R 7.69711747f
+
+// Draws falling out of their layer (about 1.2% of them): wedges and tail
+static float randNormalSlow(rand_state* state, int32 hz, uint32 iz) {
+    while (true) {
+        if (iz == 0) {
+            float x, y;
+            do {
+                x = -logf(randRawToOpenFloat(randU32(state))) * (1.0f / RAND_NORMAL_R);
+                y = -logf(randRawToOpenFloat(randU32(state)));
+            } while (y + y < x * x);
+            return hz > 0 ? RAND_NORMAL_R + x : -RAND_NORMAL_R - x;
+        }
+        const float x = (float)hz * randNormalW[iz];
+        if (randNormalF[iz] + randFloat(state) * (randNormalF[iz - 1] - randNormalF[iz]) < expf(-0.5f * x * x)) return x;
+
+        const uint32 r = randU32(state);
+        iz = r & 127;
+        hz = (int32)r >> 7;
+        if ((uint32)(hz < 0 ? -hz : hz) < randNormalK[iz]) return (float)hz * randNormalW[iz];
+    }
+}
+static float randExpSlow(rand_state* state, uint32 jz, uint32 iz) {
+    while (true) {
+        if (iz == 0) return RAND_EXP_R - logf(randRawToOpenFloat(randU32(state)));
+        const float x = (float)jz * randExpW[iz];
+        if (randExpF[iz] + randFloat(state) * (randExpF[iz - 1] - randExpF[iz]) < expf(-x)) return x;
+
+        const uint32 r = randU32(state);
+        iz = r & 255;
+        jz = r >> 8;
+        if (jz < randExpK[iz]) return (float)jz * randExpW[iz];
+    }
+}
+// The low bits pick the layer, the others the position in it
+static inline float randRawToNormal(rand_state* state, uint32 r) {
+    const uint32 iz = r & 127;
+    const int32 hz = (int32)r >> 7;
+    if ((uint32)(hz < 0 ? -hz : hz) < randNormalK[iz]) return (float)hz * randNormalW[iz];
+    return randNormalSlow(state, hz, iz);
+}
+static inline float randRawToExp(rand_state* state, uint32 r) {
+    const uint32 iz = r & 255, jz = r >> 8;
+    if (jz < randExpK[iz]) return (float)jz * randExpW[iz];
+    return randExpSlow(state, jz, iz);
+}
+
+static inline vec2 randRawToCircle(uint32 r) {
+    vec2 p;
+    randSinCos(randRawToFloat(r), &p.y, &p.x);
+    return p;
+}
+static inline vec2 randRawToDisk(uint32 r1, uint32 r2) {
+    float s, c;
+    randSinCos(randRawToFloat(r2), &s, &c);
+    const float r = sqrtf(randRawToFloat(r1));
+    return Vec2(r * c, r * s);
+}
+static inline vec3 randRawToSphere(uint32 r1, uint32 r2) {
+    float s, c;
+    randSinCos(randRawToFloat(r2), &s, &c);
+    const float z = 1.0f - 2.0f * randRawToFloat(r1), rr = 1.0f - z * z;
+    const float r = sqrtf(rr > 0.0f ? rr : 0.0f);
+    return Vec3(r * c, r * s, z);
+}
+// Malley's method: uniform disk point lifted onto the hemisphere
+static inline vec3 randRawToHemisphereCosine(uint32 r1, uint32 r2) {
+    float s, c;
+    randSinCos(randRawToFloat(r2), &s, &c);
+    const float u = randRawToFloat(r1), r = sqrtf(u);
+    return Vec3(r * c, r * s, sqrtf(1.0f - u));
+}
+
+float randNormal(rand_state* state) {
+    return randRawToNormal(state, randU32(state));
+}
+float randExponential(rand_state* state) {
+    return randRawToExp(state, randU32(state));
+}
+vec2 randCircle(rand_state* state) {
+    return randRawToCircle(randU32(state));
+}
+vec2 randDisk(rand_state* state) {
+    const uint32 r1 = randU32(state);
+    return randRawToDisk(r1, randU32(state));
+}
+vec3 randSphere(rand_state* state) {
+    const uint32 r1 = randU32(state);
+    return randRawToSphere(r1, randU32(state));
+}
+vec3 randHemisphereCosine(rand_state* state) {
+    const uint32 r1 = randU32(state);
+    return randRawToHemisphereCosine(r1, randU32(state));
+}
+
+static void randNormalTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    float* restrict c = out;
+    for (uint i = 0; i < count; i++) c[i] = randRawToNormal(state, raw[i]);
+}
+static void randExpTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    float* restrict c = out;
+    for (uint i = 0; i < count; i++) c[i] = randRawToExp(state, raw[i]);
+}
+static void randCircleTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    vec2* restrict c = out;
+    (void)state;
+    for (uint i = 0; i < count; i++) c[i] = randRawToCircle(raw[i]);
+}
+static void randDiskTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    vec2* restrict c = out;
+    (void)state;
+    for (uint i = 0; i < count; i++) c[i] = randRawToDisk(raw[2 * i], raw[2 * i + 1]);
+}
+static void randSphereTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    vec3* restrict c = out;
+    (void)state;
+    for (uint i = 0; i < count; i++) c[i] = randRawToSphere(raw[2 * i], raw[2 * i + 1]);
+}
+static void randHemisphereCosineTransform(rand_state* state, const uint32* restrict raw, uint count, void* restrict out) {
+    vec3* restrict c = out;
+    (void)state;
+    for (uint i = 0; i < count; i++) c[i] = randRawToHemisphereCosine(raw[2 * i], raw[2 * i + 1]);
+}
+
+float* randNormal_Batch(rand_state* state, uint count, float* restrict c) {
+    if (!c) c = randAlloc(sizeof(float) * count);
+    randBlocks(state, count, 1, sizeof(float), randNormalTransform, c);
+    return c;
+}
+float* randExponential_Batch(rand_state* state, uint count, float* restrict c) {
+    if (!c) c = randAlloc(sizeof(float) * count);
+    randBlocks(state, count, 1, sizeof(float), randExpTransform, c);
+    return c;
+}
+vec2* randCircle_Batch(rand_state* state, uint count, vec2* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec2) * count);
+    randBlocks(state, count, 1, sizeof(vec2), randCircleTransform, c);
+    return c;
+}
+vec2* randDisk_Batch(rand_state* state, uint count, vec2* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec2) * count);
+    randBlocks(state, count, 2, sizeof(vec2), randDiskTransform, c);
+    return c;
+}
+vec3* randSphere_Batch(rand_state* state, uint count, vec3* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec3) * count);
+    randBlocks(state, count, 2, sizeof(vec3), randSphereTransform, c);
+    return c;
+}
+vec3* randHemisphereCosine_Batch(rand_state* state, uint count, vec3* restrict c) {
+    if (!c) c = randAlloc(sizeof(vec3) * count);
+    randBlocks(state, count, 2, sizeof(vec3), randHemisphereCosineTransform, c);
+    return c;
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifndef __SL_MATHS_RANDOM_H__
+#define __SL_MATHS_RANDOM_H__
+
+#include "../structures.h"
+#include "vector.h"
+
+// PCG32 (XSH RR): 64 bit LCG state, 32 bit output, period 2^64 on each of 2^63 streams
+
+/// @brief State of a random number generator
+typedef struct RandomState {
+    uint64 state;
+    uint64 increment;   // Selects the stream (always odd)
+} rand_state;
+
+/// @brief Create a random state
+/// @param seed The seed, giving the starting point in the stream
+/// @param stream The stream, in [0, 2^63[ (states on different streams give unrelated sequences, even with the same seed)
+/// @return The newly created random state
+rand_state createRandState(uint64 seed, uint64 stream);
+
+/// @brief Produce a random uint32 with uniform distribution
+/// @param state The random state
+/// @return A random uint32
+static inline uint32 randU32(rand_state* state) {
+    const uint64 old = state->state;
+    state->state = old * 6364136223846793005ull + state->increment;
+    const uint32 xorShifted = (uint32)(((old >> 18u) ^ old) >> 27u);
+    const uint32 rot = (uint32)(old >> 59u);
+    return (xorShifted >> rot) | (xorShifted << ((-rot) & 31u));
+}
+/// @brief Produce a random uint64 with uniform distribution
+/// @param state The random state
+/// @return A random uint64
+/// @note Draws two uint32
+static inline uint64 randU64(rand_state* state) {
+    const uint64 high = randU32(state);
+    return high << 32 | randU32(state);
+}
+/// @brief Produce a random float with uniform distribution
+/// @param state The random state
+/// @return A random float in [0, 1[ (multiple of 2^-24)
+static inline float randFloat(rand_state* state) {
+    return (float)(randU32(state) >> 8) * (1.0f / 16777216.0f);
+}
+/// @brief Produce a random uint32 with uniform distribution below a bound
+/// @param state The random state
+/// @param bound The bound (must not be 0)
+/// @return A random uint32 in [0, bound[, without modulo bias
+static inline uint32 randBounded(rand_state* state, uint32 bound) {
+    // Lemire's multiply and reject: only divides when the first draw lands in the biased range
+    uint64 m = (uint64)randU32(state) * bound;
+    if ((uint32)m < bound) {
+        const uint32 threshold = -bound % bound;
+        while ((uint32)m < threshold) m = (uint64)randU32(state) * bound;
+    }
+    return (uint32)(m >> 32);
+}
+
+/// @brief Move a random state forward (or backward) in its stream
+/// @param state The random state
+/// @param delta The number of uint32 draws to skip (negative values wrap around the period and go backward)
+/// @note Takes O(log(delta)) steps: give each worker the same state advanced by a different multiple of the number of draws it needs
+void randAdvance(rand_state* state, uint64 delta);
+
+/// @brief Get the random state of the calling thread
+/// @return The random state used by SL_randU32, SL_randFloat, rand2... on this thread
+/// @note Each thread starts with seed 0 on its own stream, numbered in order of first use (stream 0 for the first thread)
+rand_state* SL_getRandState();
+
+
+///// BULK GENERATION
+
+// The batches seed 16 xoshiro128** lanes from the state (drawing 64 uint32 from it), then run the lanes
+// side by side in a branch-free loop vectorized by the compiler (plain scalar code without SIMD).
+// Outputs depend on the state and the count, and differ from the same number of single draws.
+// Batches of fewer than 64 values simply draw them from the state.
+
+/// @brief Fill a buffer with random uint32
+/// @param state The random state (moved forward by at most 64 draws)
+/// @param count The number of values
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+uint32* randU32_Batch(rand_state* state, uint count, uint32* restrict destination);
+/// @brief Fill a buffer with random floats in [0, 1[
+/// @param state The random state (moved forward by at most 64 draws)
+/// @param count The number of values
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+float* randFloat_Batch(rand_state* state, uint count, float* restrict destination);
+/// @brief Fill a buffer with random vec2 in [0, 1[²
+/// @param state The random state (moved forward by at most 64 draws)
+/// @param count The number of vectors
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* rand2_Batch(rand_state* state, uint count, vec2* restrict destination);
+/// @brief Fill a buffer with random vec3 in [0, 1[³
+/// @param state The random state (moved forward by at most 64 draws)
+/// @param count The number of vectors
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* rand3_Batch(rand_state* state, uint count, vec3* restrict destination);
+/// @brief Fill a buffer with random vec4 in [0, 1[⁴
+/// @param state The random state (moved forward by at most 64 draws)
+/// @param count The number of vectors
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec4* rand4_Batch(rand_state* state, uint count, vec4* restrict destination);
+
+
+///// DISTRIBUTIONS
+
+// The samplers never reject on the fast path and use no trigonometric function (polynomial sine and cosine).
+// Their batches draw the raw values from lanes like the bulk fills, then transform them in vectorizable loops.
+
+/// @brief Sample the standard normal distribution
+/// @param state The random state
+/// @return A random float with mean 0 and standard deviation 1
+/// @note Ziggurat method: one draw and one comparison about 99% of the time
+float randNormal(rand_state* state);
+/// @brief Sample the exponential distribution
+/// @param state The random state
+/// @return A random float with rate 1 (mean 1)
+/// @note Ziggurat method: one draw and one comparison about 99% of the time
+float randExponential(rand_state* state);
+/// @brief Sample a uniformly distributed point on the unit circle
+/// @param state The random state
+/// @return A random unit vec2
+vec2 randCircle(rand_state* state);
+/// @brief Sample a uniformly distributed point in the unit disk
+/// @param state The random state
+/// @return A random vec2 of length at most 1
+vec2 randDisk(rand_state* state);
+/// @brief Sample a uniformly distributed point on the unit sphere
+/// @param state The random state
+/// @return A random unit vec3
+vec3 randSphere(rand_state* state);
+/// @brief Sample a cosine weighted direction on the unit hemisphere around +z
+/// @param state The random state
+/// @return A random unit vec3 with z >= 0, with density cos(theta) / PI
+/// @note Use as the direction of a diffuse bounce in tangent space
+vec3 randHemisphereCosine(rand_state* state);
+
+/// @brief Fill a buffer with samples of the standard normal distribution
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+float* randNormal_Batch(rand_state* state, uint count, float* restrict destination);
+/// @brief Fill a buffer with samples of the exponential distribution (rate 1)
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+float* randExponential_Batch(rand_state* state, uint count, float* restrict destination);
+/// @brief Fill a buffer with uniformly distributed points on the unit circle
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* randCircle_Batch(rand_state* state, uint count, vec2* restrict destination);
+/// @brief Fill a buffer with uniformly distributed points in the unit disk
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* randDisk_Batch(rand_state* state, uint count, vec2* restrict destination);
+/// @brief Fill a buffer with uniformly distributed points on the unit sphere
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* randSphere_Batch(rand_state* state, uint count, vec3* restrict destination);
+/// @brief Fill a buffer with cosine weighted directions on the unit hemisphere around +z
+/// @param state The random state
+/// @param count The number of samples
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* randHemisphereCosine_Batch(rand_state* state, uint count, vec3* restrict destination);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,366 @@
+#include "sequence.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "math.h"
+#include "../utils/inout.h"
+
+static void* sequenceAlloc(size_t size) {
+    void* new = malloc(size);
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate sequence points!");
+    return new;
+}
+
+// 32 bit fixed point fraction to float in [0, 1[ (top 24 bits, exact)
+static inline float sequenceToFloat(uint32 x) {
+    return (float)(int32)(x >> 8) * (1.0f / 16777216.0f);
+}
+
+// Toroidal shift of a coordinate, as a fixed point fraction
+static inline uint32 sequenceShift(uint32 seed, uint dimension) {
+    return seed ? SL_PCGHash(seed + SL_PCGHash(dimension)) : 0;
+}
+
+static inline uint32 sequenceReverseBits(uint32 x) {
+    x = (x << 16) | (x >> 16);
+    x = ((x & 0x00ff00ffu) << 8) | ((x >> 8) & 0x00ff00ffu);
+    x = ((x & 0x0f0f0f0fu) << 4) | ((x >> 4) & 0x0f0f0f0fu);
+    x = ((x & 0x33333333u) << 2) | ((x >> 2) & 0x33333333u);
+    return ((x & 0x55555555u) << 1) | ((x >> 1) & 0x55555555u);
+}
+
+
+
+///// SOBOL
+
+// Generator matrices (Joe & Kuo direction numbers): column i is added for bit i of the index
+static const uint32 sobolMatrices[SOBOL_DIMENSIONS][32] = {
+    {
+        0x80000000u, 0x40000000u, 0x20000000u, 0x10000000u, 0x08000000u, 0x04000000u, 0x02000000u, 0x01000000u,
+        0x00800000u, 0x00400000u, 0x00200000u, 0x00100000u, 0x00080000u, 0x00040000u, 0x00020000u, 0x00010000u,
+        0x00008000u, 0x00004000u, 0x00002000u, 0x00001000u, 0x00000800u, 0x00000400u, 0x00000200u, 0x00000100u,
+        0x00000080u, 0x00000040u, 0x00000020u, 0x00000010u, 0x00000008u, 0x00000004u, 0x00000002u, 0x00000001u
+    },
+    {
+        0x80000000u, 0xc0000000u, 0xa0000000u, 0xf0000000u, 0x88000000u, 0xcc000000u, 0xaa000000u, 0xff000000u,
+        0x80800000u, 0xc0c00000u, 0xa0a00000u, 0xf0f00000u, 0x88880000u, 0xcccc0000u, 0xaaaa0000u, 0xffff0000u,
+        0x80008000u, 0xc000c000u, 0xa000a000u, 0xf000f000u, 0x88008800u, 0xcc00cc00u, 0xaa00aa00u, 0xff00ff00u,
+        0x80808080u, 0xc0c0c0c0u, 0xa0a0a0a0u, 0xf0f0f0f0u, 0x88888888u, 0xccccccccu, 0xaaaaaaaau, 0xffffffffu
+    },
+    {
+        0x80000000u, 0xc0000000u, 0x60000000u, 0x90000000u, 0xe8000000u, 0x5c000000u, 0x8e000000u, 0xc5000000u,
+        0x68800000u, 0x9cc00000u, 0xee600000u, 0x55900000u, 0x80680000u, 0xc09c0000u, 0x60ee0000u, 0x90550000u,
+        0xe8808000u, 0x5cc0c000u, 0x8e606000u, 0xc5909000u, 0x6868e800u, 0x9c9c5c00u, 0xeeee8e00u, 0x5555c500u,
+        0x8000e880u, 0xc0005cc0u, 0x60008e60u, 0x9000c590u, 0xe8006868u, 0x5c009c9cu, 0x8e00eeeeu, 0xc5005555u
+    },
+    {
+        0x80000000u, 0xc0000000u, 0x20000000u, 0x50000000u, 0xf8000000u, 0x74000000u, 0xa2000000u, 0x93000000u,
+        0xd8800000u, 0x25400000u, 0x59e00000u, 0xe6d00000u, 0x78080000u, 0xb40c0000u, 0x82020000u, 0xc3050000u,
+        0x208f8000u, 0x51474000u, 0xfbea2000u, 0x75d93000u, 0xa0858800u, 0x914e5400u, 0xdbe79e00u, 0x25db6d00u,
+        0x58800080u, 0xe54000c0u, 0x79e00020u, 0xb6d00050u, 0x800800f8u, 0xc00c0074u, 0x200200a2u, 0x50050093u
+    }
+};
+
+// XOR of the matrix columns selected by every value of each byte of the index (built on first use)
+static uint32 sobolBytes[SOBOL_DIMENSIONS][4][256];
+static pthread_once_t sobolOnce = PTHREAD_ONCE_INIT;
+
+static void sobolGenerate() {
+    for (uint d = 0; d < SOBOL_DIMENSIONS; d++)
+    for (uint b = 0; b < 4; b++)
+    for (uint v = 0; v < 256; v++) {
+        uint32 x = 0;
+        for (uint i = 0; i < 8; i++) if (v >> i & 1) x ^= sobolMatrices[d][8 * b + i];
+        sobolBytes[d][b][v] = x;
+    }
+}
+
+// Matrix product of the index, once the tables exist
+static inline uint32 sobolProduct(uint32 index, uint dimension) {
+    const uint32 (*t)[256] = sobolBytes[dimension];
+    return t[0][index & 0xff] ^ t[1][index >> 8 & 0xff] ^ t[2][index >> 16 & 0xff] ^ t[3][index >> 24];
+}
+
+uint32 sobolU32(uint32 index, uint dimension) {
+    pthread_once(&sobolOnce, sobolGenerate);
+    return sobolProduct(index, dimension);
+}
+
+// Laine-Karras permutation: each bit only depends on the bits below it
+static inline uint32 sobolLaineKarras(uint32 x, uint32 seed) {
+    x += seed;
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return x;
+}
+// Owen scrambling: each bit is flipped depending on the bits above it
+static inline uint32 sobolScramble(uint32 x, uint32 seed) {
+    return sequenceReverseBits(sobolLaineKarras(sequenceReverseBits(x), seed));
+}
+static inline uint32 sobolSeed(uint32 seed, uint dimension) {
+    return seed ^ (dimension + (seed << 6) + (seed >> 2));
+}
+
+vec2 sobol2(uint32 index, uint32 seed) {
+    pthread_once(&sobolOnce, sobolGenerate);
+    seed = SL_PCGHash(seed);
+    index = sobolScramble(index, seed);
+    return Vec2(
+        sequenceToFloat(sobolScramble(sequenceReverseBits(index), sobolSeed(seed, 0))),
+        sequenceToFloat(sobolScramble(sobolProduct(index, 1), sobolSeed(seed, 1)))
+    );
+}
+vec3 sobol3(uint32 index, uint32 seed) {
+    pthread_once(&sobolOnce, sobolGenerate);
+    seed = SL_PCGHash(seed);
+    index = sobolScramble(index, seed);
+    return Vec3(
+        sequenceToFloat(sobolScramble(sequenceReverseBits(index), sobolSeed(seed, 0))),
+        sequenceToFloat(sobolScramble(sobolProduct(index, 1), sobolSeed(seed, 1))),
+        sequenceToFloat(sobolScramble(sobolProduct(index, 2), sobolSeed(seed, 2)))
+    );
+}
+
+vec2* sobol2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec2) * count);
+    for (uint i = 0; i < count; i++) c[i] = sobol2(first + i, seed);
+    return c;
+}
+vec3* sobol3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec3) * count);
+    for (uint i = 0; i < count; i++) c[i] = sobol3(first + i, seed);
+    return c;
+}
+
+
+
+///// HALTON
+
+// Radical inverse: the digits of the index in the base, mirrored after the point (as a fixed point fraction)
+static inline uint32 haltonRadicalInverse(uint32 index, uint32 base) {
+    if (base == 2) return sequenceReverseBits(index);
+    uint64 reversed = 0, scale = 1;
+    while (index) {
+        reversed = reversed * base + index % base;
+        index /= base;
+        scale *= base;
+    }
+    return (uint32)((double)reversed / (double)scale * 4294967296.0);
+}
+
+vec2 halton2(uint32 index, uint32 seed) {
+    return Vec2(
+        sequenceToFloat(haltonRadicalInverse(index, 2) + sequenceShift(seed, 0)),
+        sequenceToFloat(haltonRadicalInverse(index, 3) + sequenceShift(seed, 1))
+    );
+}
+vec3 halton3(uint32 index, uint32 seed) {
+    return Vec3(
+        sequenceToFloat(haltonRadicalInverse(index, 2) + sequenceShift(seed, 0)),
+        sequenceToFloat(haltonRadicalInverse(index, 3) + sequenceShift(seed, 1)),
+        sequenceToFloat(haltonRadicalInverse(index, 5) + sequenceShift(seed, 2))
+    );
+}
+
+vec2* halton2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec2) * count);
+    for (uint i = 0; i < count; i++) c[i] = halton2(first + i, seed);
+    return c;
+}
+vec3* halton3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec3) * count);
+    for (uint i = 0; i < count; i++) c[i] = halton3(first + i, seed);
+    return c;
+}
+
+
+
+///// KRONECKER
+
+// Powers of the inverse of the plastic number (R2) and of the root of x^4 = x + 1 (R3), as fixed point fractions:
+// the wrap around of the integer multiplication is the fractional part, exact for every index
+#define R2_ALPHA_X 0xc13fa9a9u
+#define R2_ALPHA_Y 0x91e10da6u
+#define R3_ALPHA_X 0xd1b54a33u
+#define R3_ALPHA_Y 0xabc98389u
+#define R3_ALPHA_Z 0x8cb92ba7u
+// The sequences start at 0.5
+#define KRONECKER_START 0x80000000u
+
+vec2 kronecker2(uint32 index, uint32 seed) {
+    return Vec2(
+        sequenceToFloat(KRONECKER_START + index * R2_ALPHA_X + sequenceShift(seed, 0)),
+        sequenceToFloat(KRONECKER_START + index * R2_ALPHA_Y + sequenceShift(seed, 1))
+    );
+}
+vec3 kronecker3(uint32 index, uint32 seed) {
+    return Vec3(
+        sequenceToFloat(KRONECKER_START + index * R3_ALPHA_X + sequenceShift(seed, 0)),
+        sequenceToFloat(KRONECKER_START + index * R3_ALPHA_Y + sequenceShift(seed, 1)),
+        sequenceToFloat(KRONECKER_START + index * R3_ALPHA_Z + sequenceShift(seed, 2))
+    );
+}
+
+vec2* kronecker2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec2) * count);
+    for (uint i = 0; i < count; i++) c[i] = kronecker2(first + i, seed);
+    return c;
+}
+vec3* kronecker3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec3) * count);
+    for (uint i = 0; i < count; i++) c[i] = kronecker3(first + i, seed);
+    return c;
+}
+
+
+
+///// BLUE NOISE
+
+#define BLUE_NOISE_AREA (BLUE_NOISE_SIZE * BLUE_NOISE_SIZE)
+// Gaussian energy of the void and cluster method: sigma 1.5, cut off at 6 pixels
+#define BLUE_NOISE_SIGMA 1.5f
+#define BLUE_NOISE_RADIUS 6
+// Proportion of the first pattern
+#define BLUE_NOISE_INITIAL (BLUE_NOISE_AREA / 10)
+// Shift of the values between two successive samples (golden ratio, as a fixed point fraction)
+#define BLUE_NOISE_GOLDEN 0x9e3779b9u
+
+// Rank of every pixel of the tile, in [0, BLUE_NOISE_AREA[
+static uint16 blueNoiseRank[BLUE_NOISE_AREA];
+static pthread_once_t blueNoiseOnce = PTHREAD_ONCE_INIT;
+
+static float blueNoiseKernel[2 * BLUE_NOISE_RADIUS + 1][2 * BLUE_NOISE_RADIUS + 1];
+
+// Add (or remove) the energy of a set pixel around it, wrapping around the tile
+static void blueNoiseSplat(float* energy, uint p, float sign) {
+    const int px = p % BLUE_NOISE_SIZE, py = p / BLUE_NOISE_SIZE;
+    for (int dy = -BLUE_NOISE_RADIUS; dy <= BLUE_NOISE_RADIUS; dy++)
+    for (int dx = -BLUE_NOISE_RADIUS; dx <= BLUE_NOISE_RADIUS; dx++) {
+        const uint q = ((px + dx) & (BLUE_NOISE_SIZE - 1)) + BLUE_NOISE_SIZE * ((py + dy) & (BLUE_NOISE_SIZE - 1));
+        energy[q] += sign * blueNoiseKernel[dy + BLUE_NOISE_RADIUS][dx + BLUE_NOISE_RADIUS];
+    }
+}
+// Tightest cluster (set pixel of highest energy) or largest void (unset pixel of lowest energy)
+static uint blueNoiseFind(const float* energy, const bool* pattern, bool cluster) {
+    uint best = 0;
+    float bestEnergy = cluster ? -1.0f : 1e30f;
+    for (uint p = 0; p < BLUE_NOISE_AREA; p++) {
+        if (pattern[p] != cluster) continue;
+        if (cluster ? energy[p] > bestEnergy : energy[p] < bestEnergy) { best = p; bestEnergy = energy[p]; }
+    }
+    return best;
+}
+
+// Void and cluster method (Ulichney 1993): rank the pixels so that every threshold gives an evenly spread pattern
+static void blueNoiseGenerate() {
+    for (int dy = -BLUE_NOISE_RADIUS; dy <= BLUE_NOISE_RADIUS; dy++)
+    for (int dx = -BLUE_NOISE_RADIUS; dx <= BLUE_NOISE_RADIUS; dx++)
+        blueNoiseKernel[dy + BLUE_NOISE_RADIUS][dx + BLUE_NOISE_RADIUS] = expf(-(float)(dx * dx + dy * dy) / (2.0f * BLUE_NOISE_SIGMA * BLUE_NOISE_SIGMA));
+
+    bool* pattern = calloc(2 * BLUE_NOISE_AREA, sizeof(bool));
+    float* energy = calloc(2 * BLUE_NOISE_AREA, sizeof(float));
+    if (!pattern || !energy) SL_throwError("INSUFFICIENT MEMORY - Failed to generate blue noise!");
+    bool* firstPattern = pattern + BLUE_NOISE_AREA;
+    float* firstEnergy = energy + BLUE_NOISE_AREA;
+
+    // Random first pattern (fixed seed: the tile is the same everywhere)
+    uint32 h = 0;
+    for (uint set = 0; set < BLUE_NOISE_INITIAL;) {
+        h = SL_PCGHash(h);
+        const uint p = h % BLUE_NOISE_AREA;
+        if (pattern[p]) continue;
+        pattern[p] = true;
+        blueNoiseSplat(energy, p, 1.0f);
+        set++;
+    }
+
+    // Spread it: move the tightest cluster to the largest void until it stays in place
+    for (uint i = 0; i < BLUE_NOISE_AREA; i++) {
+        const uint cluster = blueNoiseFind(energy, pattern, true);
+        pattern[cluster] = false;
+        blueNoiseSplat(energy, cluster, -1.0f);
+        const uint gap = blueNoiseFind(energy, pattern, false);
+        pattern[gap] = true;
+        blueNoiseSplat(energy, gap, 1.0f);
+        if (gap == cluster) break;
+    }
+    for (uint p = 0; p < BLUE_NOISE_AREA; p++) { firstPattern[p] = pattern[p]; firstEnergy[p] = energy[p]; }
+
+    // Ranks below the first pattern: remove the tightest clusters one by one
+    for (uint rank = BLUE_NOISE_INITIAL; rank > 0; rank--) {
+        const uint cluster = blueNoiseFind(energy, pattern, true);
+        pattern[cluster] = false;
+        blueNoiseSplat(energy, cluster, -1.0f);
+        blueNoiseRank[cluster] = rank - 1;
+    }
+
+    // Ranks above: fill the largest voids one by one (past half full, the largest void of the set pixels
+    // is also the tightest cluster of the unset ones, so this phase goes all the way)
+    for (uint rank = BLUE_NOISE_INITIAL; rank < BLUE_NOISE_AREA; rank++) {
+        const uint gap = blueNoiseFind(firstEnergy, firstPattern, false);
+        firstPattern[gap] = true;
+        blueNoiseSplat(firstEnergy, gap, 1.0f);
+        blueNoiseRank[gap] = rank;
+    }
+
+    free(pattern);
+    free(energy);
+}
+
+// Tile offsets of the coordinates of blueNoise2 and blueNoise3
+static const int blueNoiseChannel[3][2] = {{0, 0}, {23, 41}, {47, 13}};
+
+// Rank of a pixel as a fixed point fraction (center of its bin), shifted for the sample
+static inline uint32 blueNoiseValue(int x, int y, uint32 shift) {
+    const uint p = ((uint)x & (BLUE_NOISE_SIZE - 1)) + BLUE_NOISE_SIZE * ((uint)y & (BLUE_NOISE_SIZE - 1));
+    return ((uint32)blueNoiseRank[p] << 20 | 1u << 19) + shift;
+}
+static inline void blueNoiseOffset(uint32 seed, int* x, int* y) {
+    const uint32 h = SL_PCGHash(seed);
+    *x += h & (BLUE_NOISE_SIZE - 1);
+    *y += (h >> 6) & (BLUE_NOISE_SIZE - 1);
+}
+
+float blueNoise(int x, int y, uint32 index, uint32 seed) {
+    pthread_once(&blueNoiseOnce, blueNoiseGenerate);
+    blueNoiseOffset(seed, &x, &y);
+    return sequenceToFloat(blueNoiseValue(x, y, index * BLUE_NOISE_GOLDEN));
+}
+vec2 blueNoise2(int x, int y, uint32 index, uint32 seed) {
+    pthread_once(&blueNoiseOnce, blueNoiseGenerate);
+    blueNoiseOffset(seed, &x, &y);
+    return Vec2(
+        sequenceToFloat(blueNoiseValue(x, y, index * R2_ALPHA_X)),
+        sequenceToFloat(blueNoiseValue(x + blueNoiseChannel[1][0], y + blueNoiseChannel[1][1], index * R2_ALPHA_Y))
+    );
+}
+vec3 blueNoise3(int x, int y, uint32 index, uint32 seed) {
+    pthread_once(&blueNoiseOnce, blueNoiseGenerate);
+    blueNoiseOffset(seed, &x, &y);
+    return Vec3(
+        sequenceToFloat(blueNoiseValue(x, y, index * R3_ALPHA_X)),
+        sequenceToFloat(blueNoiseValue(x + blueNoiseChannel[1][0], y + blueNoiseChannel[1][1], index * R3_ALPHA_Y)),
+        sequenceToFloat(blueNoiseValue(x + blueNoiseChannel[2][0], y + blueNoiseChannel[2][1], index * R3_ALPHA_Z))
+    );
+}
+
+float* blueNoise_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, float* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(float) * size.x * size.y);
+    for (uint y = 0; y < size.y; y++)
+    for (uint x = 0; x < size.x; x++) c[x + (size_t)size.x * y] = blueNoise(origin.x + (int)x, origin.y + (int)y, index, seed);
+    return c;
+}
+vec2* blueNoise2_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, vec2* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec2) * size.x * size.y);
+    for (uint y = 0; y < size.y; y++)
+    for (uint x = 0; x < size.x; x++) c[x + (size_t)size.x * y] = blueNoise2(origin.x + (int)x, origin.y + (int)y, index, seed);
+    return c;
+}
+vec3* blueNoise3_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, vec3* restrict c) {
+    if (!c) c = sequenceAlloc(sizeof(vec3) * size.x * size.y);
+    for (uint y = 0; y < size.y; y++)
+    for (uint x = 0; x < size.x; x++) c[x + (size_t)size.x * y] = blueNoise3(origin.x + (int)x, origin.y + (int)y, index, seed);
+    return c;
+}
\ No newline at end of file
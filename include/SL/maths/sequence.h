@@ -0,0 +1,163 @@
+#ifndef __SL_MATHS_SEQUENCE_H__
+#define __SL_MATHS_SEQUENCE_H__
+
+#include "../structures.h"
+#include "vector.h"
+
+// Low discrepancy sequences: points covering [0, 1[^n far more evenly than random ones, so estimates built
+// from n samples converge much faster. Every point only depends on its index and a seed: give each thread
+// its own range of indices, or its own seed for an independent randomization of the whole sequence.
+
+/// @brief Number of dimensions of the Sobol sequence
+#define SOBOL_DIMENSIONS 4
+
+/// @brief Get a coordinate of the unscrambled Sobol sequence
+/// @param index The index of the point
+/// @param dimension The coordinate, in [0, SOBOL_DIMENSIONS[
+/// @return The coordinate as a 32 bit fixed point fraction (divide by 2^32 for [0, 1[)
+uint32 sobolU32(uint32 index, uint dimension);
+
+/// @brief Get a point of the Owen scrambled Sobol sequence in 2D
+/// @param index The index of the point
+/// @param seed The scrambling seed (each seed gives an independent randomization)
+/// @return The point in [0, 1[²
+/// @note Uses hash based nested uniform scrambling (Burley 2020), which also shuffles the order of the points while keeping every power of two prefix well stratified
+vec2 sobol2(uint32 index, uint32 seed);
+/// @brief Get a point of the Owen scrambled Sobol sequence in 3D
+/// @param index The index of the point
+/// @param seed The scrambling seed (each seed gives an independent randomization)
+/// @return The point in [0, 1[³
+/// @note Uses hash based nested uniform scrambling (Burley 2020), which also shuffles the order of the points while keeping every power of two prefix well stratified
+vec3 sobol3(uint32 index, uint32 seed);
+
+/// @brief Get a point of the Halton sequence in 2D (bases 2 and 3)
+/// @param index The index of the point
+/// @param seed The seed of a random toroidal shift of the whole sequence (0 for no shift)
+/// @return The point in [0, 1[²
+vec2 halton2(uint32 index, uint32 seed);
+/// @brief Get a point of the Halton sequence in 3D (bases 2, 3 and 5)
+/// @param index The index of the point
+/// @param seed The seed of a random toroidal shift of the whole sequence (0 for no shift)
+/// @return The point in [0, 1[³
+vec3 halton3(uint32 index, uint32 seed);
+
+/// @brief Get a point of the R2 sequence (Kronecker sequence of the plastic number)
+/// @param index The index of the point
+/// @param seed The seed of a random toroidal shift of the whole sequence (0 for no shift)
+/// @return The point in [0, 1[²
+/// @note Cheapest of the sequences, and good for any number of points (no power of two prefixes)
+vec2 kronecker2(uint32 index, uint32 seed);
+/// @brief Get a point of the R3 sequence (Kronecker sequence of the generalized golden ratio of dimension 3)
+/// @param index The index of the point
+/// @param seed The seed of a random toroidal shift of the whole sequence (0 for no shift)
+/// @return The point in [0, 1[³
+/// @note Cheapest of the sequences, and good for any number of points (no power of two prefixes)
+vec3 kronecker3(uint32 index, uint32 seed);
+
+/// @brief Fill a buffer with consecutive points of the Owen scrambled Sobol sequence in 2D
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The scrambling seed
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* sobol2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict destination);
+/// @brief Fill a buffer with consecutive points of the Owen scrambled Sobol sequence in 3D
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The scrambling seed
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* sobol3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict destination);
+/// @brief Fill a buffer with consecutive points of the Halton sequence in 2D
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The seed of the toroidal shift (0 for no shift)
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* halton2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict destination);
+/// @brief Fill a buffer with consecutive points of the Halton sequence in 3D
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The seed of the toroidal shift (0 for no shift)
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* halton3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict destination);
+/// @brief Fill a buffer with consecutive points of the R2 sequence
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The seed of the toroidal shift (0 for no shift)
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* kronecker2_Batch(uint32 first, uint count, uint32 seed, vec2* restrict destination);
+/// @brief Fill a buffer with consecutive points of the R3 sequence
+/// @param first The index of the first point
+/// @param count The number of points
+/// @param seed The seed of the toroidal shift (0 for no shift)
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* kronecker3_Batch(uint32 first, uint count, uint32 seed, vec3* restrict destination);
+
+
+///// BLUE NOISE
+
+/// @brief Side of the blue noise tile
+#define BLUE_NOISE_SIZE 64
+
+/// @brief Sample the tiled blue noise
+/// @param x The x coordinate of the pixel (the tile repeats every BLUE_NOISE_SIZE pixels)
+/// @param y The y coordinate of the pixel
+/// @param index The index of the sample (each index shifts all the values by the golden ratio, so successive samples of a pixel stay evenly spread)
+/// @param seed The seed of a random offset of the tile
+/// @return A value in [0, 1[, whose neighbouring pixels hold values as different as possible
+/// @note The tile (void and cluster method) is generated on first use, in a few tens of milliseconds
+float blueNoise(int x, int y, uint32 index, uint32 seed);
+/// @brief Sample the tiled blue noise in 2D
+/// @param x The x coordinate of the pixel
+/// @param y The y coordinate of the pixel
+/// @param index The index of the sample (each index shifts the values by a point of the R2 sequence)
+/// @param seed The seed of a random offset of the tile
+/// @return A point in [0, 1[², each coordinate read from a different offset of the tile
+vec2 blueNoise2(int x, int y, uint32 index, uint32 seed);
+/// @brief Sample the tiled blue noise in 3D
+/// @param x The x coordinate of the pixel
+/// @param y The y coordinate of the pixel
+/// @param index The index of the sample (each index shifts the values by a point of the R3 sequence)
+/// @param seed The seed of a random offset of the tile
+/// @return A point in [0, 1[³, each coordinate read from a different offset of the tile
+vec3 blueNoise3(int x, int y, uint32 index, uint32 seed);
+
+/// @brief Fill a buffer with tiled blue noise over a rectangle of pixels
+/// @param origin The coordinates of the first pixel
+/// @param size The number of pixels along each axis
+/// @param index The index of the sample
+/// @param seed The seed of the tile offset
+/// @param destination Where the results are stored (pixel (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @return The destination value
+float* blueNoise_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, float* restrict destination);
+/// @brief Fill a buffer with 2D tiled blue noise over a rectangle of pixels
+/// @param origin The coordinates of the first pixel
+/// @param size The number of pixels along each axis
+/// @param index The index of the sample
+/// @param seed The seed of the tile offset
+/// @param destination Where the results are stored (pixel (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec2* blueNoise2_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, vec2* restrict destination);
+/// @brief Fill a buffer with 3D tiled blue noise over a rectangle of pixels
+/// @param origin The coordinates of the first pixel
+/// @param size The number of pixels along each axis
+/// @param index The index of the sample
+/// @param seed The seed of the tile offset
+/// @param destination Where the results are stored (pixel (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @return The destination value
+vec3* blueNoise3_Grid(ivec2 origin, uvec2 size, uint32 index, uint32 seed, vec3* restrict destination);
+
+#endif
\ No newline at end of file
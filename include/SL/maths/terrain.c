@@ -0,0 +1,177 @@
+#include "terrain.h"
+
+#include <stdlib.h>
+#include "../utils/inout.h"
+
+fbm_layer createFbmLayer(terrain_noise noise, uint octaves, uint32 seed) {
+    return (fbm_layer) {
+        .noise = noise,
+        .octaves = octaves,
+        .frequency = 1.0f,
+        .amplitude = 1.0f,
+        .lacunarity = 2.0f,
+        .gain = 0.5f,
+        .seed = seed
+    };
+}
+
+// Offset moving an octave to an unrelated part of the noise (kept small so positions keep their precision)
+static inline vec2 fbmOctaveOffset(uint32 seed, uint octave) {
+    uint32 h1 = SL_PCGHash(seed + SL_PCGHash(octave)), h2 = SL_PCGHash(h1);
+    return Vec2((float)(h1 >> 8) * (256.0f / 16777216.0f) - 128.0f, (float)(h2 >> 8) * (256.0f / 16777216.0f) - 128.0f);
+}
+
+static inline float fbmNoise(terrain_noise noise, vec2 p) {
+    switch (noise) {
+        case TERRAIN_NOISE_SIMPLEX: return SL_noise2D_simplex(p);
+        case TERRAIN_NOISE_VORONOI: return SL_noise2D_voronoi(p);
+        default: return SL_noise2D_perlin(p);
+    }
+}
+static inline void fbmNoise_Batch(terrain_noise noise, const vec2* p, uint count, float* restrict c) {
+    switch (noise) {
+        case TERRAIN_NOISE_SIMPLEX: SL_noise2D_simplex_Batch(p, count, c); break;
+        case TERRAIN_NOISE_VORONOI: for (uint i = 0; i < count; i++) c[i] = SL_noise2D_voronoi(p[i]); break;
+        default: SL_noise2D_perlin_Batch(p, count, c); break;
+    }
+}
+
+float SL_fbm2D(const fbm_layer* layer, vec2 p) {
+    float sum = 0.0f, frequency = layer->frequency, amplitude = layer->amplitude;
+    for (uint o = 0; o < layer->octaves; o++) {
+        const vec2 offset = fbmOctaveOffset(layer->seed, o);
+        sum += amplitude * fbmNoise(layer->noise, Vec2(p.x * frequency + offset.x, p.y * frequency + offset.y));
+        frequency *= layer->lacunarity;
+        amplitude *= layer->gain;
+    }
+    return sum;
+}
+
+// Number of positions evaluated together by each octave pass
+#define FBM_BATCH_BLOCK 64
+
+float* SL_fbm2D_Batch(const fbm_layer* layer, const vec2* p, uint count, float* restrict c) {
+    if (!c) c = malloc(sizeof(float) * count);
+    if (!c) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate fractal noise!");
+
+    vec2 q[FBM_BATCH_BLOCK];
+    float n[FBM_BATCH_BLOCK];
+    for (uint start = 0; start < count; start += FBM_BATCH_BLOCK) {
+        const uint size = count - start < FBM_BATCH_BLOCK ? count - start : FBM_BATCH_BLOCK;
+        float* restrict sum = c + start;
+        for (uint i = 0; i < size; i++) sum[i] = 0.0f;
+
+        float frequency = layer->frequency, amplitude = layer->amplitude;
+        for (uint o = 0; o < layer->octaves; o++) {
+            const vec2 offset = fbmOctaveOffset(layer->seed, o);
+            for (uint i = 0; i < size; i++) q[i] = Vec2(p[start + i].x * frequency + offset.x, p[start + i].y * frequency + offset.y);
+
+            fbmNoise_Batch(layer->noise, q, size, n);
+            for (uint i = 0; i < size; i++) sum[i] += amplitude * n[i];
+
+            frequency *= layer->lacunarity;
+            amplitude *= layer->gain;
+        }
+    }
+    return c;
+}
+
+
+
+///// TERRAIN GENERATOR
+
+// Side of the square tiles handed to the threads
+#define TERRAIN_TILE 64
+// Seed change between the x and y displacements of a warp layer
+#define TERRAIN_WARP_SEED_Y 0x9E3779B9u
+
+terrain_gen createTerrainGenerator(fbm_layer height, float pixelSize) {
+    return (terrain_gen) {
+        .height = height,
+        .warpCount = 0,
+        .pixelSize = pixelSize,
+        .pool = NULL
+    };
+}
+void terrainAddWarp(terrain_gen* generator, fbm_layer warp) {
+    if (generator->warpCount >= TERRAIN_MAX_WARPS) SL_throwError("Cannot add more than %d warp layers to a terrain generator!", TERRAIN_MAX_WARPS);
+    generator->warps[generator->warpCount++] = warp;
+}
+
+typedef struct TerrainJob {
+    const terrain_gen* generator;
+    ivec2 origin;
+    uvec2 size;
+    uint tilesX;
+    float* heights;
+} terrain_job;
+
+static void terrainTile(void* data, uint index) {
+    const terrain_job* job = data;
+    const terrain_gen* g = job->generator;
+
+    const uint x0 = (index % job->tilesX) * TERRAIN_TILE, y0 = (index / job->tilesX) * TERRAIN_TILE;
+    const uint w = job->size.x - x0 < TERRAIN_TILE ? job->size.x - x0 : TERRAIN_TILE;
+    const uint h = job->size.y - y0 < TERRAIN_TILE ? job->size.y - y0 : TERRAIN_TILE;
+
+    vec2 p[TERRAIN_TILE];
+    float dx[TERRAIN_TILE], dy[TERRAIN_TILE];
+    for (uint y = y0; y < y0 + h; y++) {
+        // Positions only depend on the pixel coordinates, never on the tile
+        const float py = (float)(job->origin.y + (int)y) * g->pixelSize;
+        for (uint i = 0; i < w; i++) p[i] = Vec2((float)(job->origin.x + (int)(x0 + i)) * g->pixelSize, py);
+
+        for (uint k = 0; k < g->warpCount; k++) {
+            fbm_layer warpY = g->warps[k];
+            warpY.seed ^= TERRAIN_WARP_SEED_Y;
+            SL_fbm2D_Batch(g->warps + k, p, w, dx);
+            SL_fbm2D_Batch(&warpY, p, w, dy);
+            for (uint i = 0; i < w; i++) { p[i].x += dx[i]; p[i].y += dy[i]; }
+        }
+
+        SL_fbm2D_Batch(&g->height, p, w, job->heights + x0 + (size_t)job->size.x * y);
+    }
+}
+
+float* terrainGenerate(const terrain_gen* generator, ivec2 pixelOrigin, uvec2 size, float* restrict c) {
+    if (!c) c = malloc(sizeof(float) * size.x * size.y);
+    if (!c) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate heightmap!");
+    if (size.x == 0 || size.y == 0) return c;
+
+    terrain_job job = {
+        .generator = generator,
+        .origin = pixelOrigin,
+        .size = size,
+        .tilesX = (size.x + TERRAIN_TILE - 1) / TERRAIN_TILE,
+        .heights = c
+    };
+    const uint tileCount = job.tilesX * ((size.y + TERRAIN_TILE - 1) / TERRAIN_TILE);
+    threadPoolRun(generator->pool ? generator->pool : SL_getThreadPool(), terrainTile, &job, tileCount);
+    return c;
+}
+
+image2D terrainGenerateImage(const terrain_gen* generator, ivec2 pixelOrigin, uvec2 size, uint8 bitDepth, float low, float high) {
+    if (bitDepth != 8 && bitDepth != 16 && bitDepth != 32) SL_throwError("Cannot generate a terrain image with bit depth %d (must be 8, 16 or 32)!", bitDepth);
+
+    image2D result = {.size = size, .channelCount = 1, .bitDepth = bitDepth};
+    float* heights = terrainGenerate(generator, pixelOrigin, size, NULL);
+    if (bitDepth == 32) {
+        result.rawData = (uint8*)heights;
+        return result;
+    }
+
+    const uint64 count = (uint64)size.x * size.y;
+    const float maxValue = bitDepth == 8 ? 255.0f : 65535.0f;
+    const float scale = high != low ? maxValue / (high - low) : 0.0f;
+    result.rawData = malloc(count * (bitDepth / 8));
+    if (!result.rawData) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate terrain image!");
+
+    for (uint64 i = 0; i < count; i++) {
+        float v = (heights[i] - low) * scale + 0.5f;
+        v = v < 0.0f ? 0.0f : (v > maxValue ? maxValue : v);
+        if (bitDepth == 8) result.rawData[i] = (uint8)v;
+        else ((uint16*)result.rawData)[i] = (uint16)v;
+    }
+    free(heights);
+    return result;
+}
\ No newline at end of file
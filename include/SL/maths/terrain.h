@@ -0,0 +1,93 @@
+#ifndef __SL_MATHS_TERRAIN_H__
+#define __SL_MATHS_TERRAIN_H__
+
+#include "../structures.h"
+#include "vector.h"
+#include "noise.h"
+#include "../utils/threadPool.h"
+#include "../utils/imageImporter.h"
+
+/// @brief Noise summed by a fractal layer
+typedef enum TerrainNoise {
+    TERRAIN_NOISE_PERLIN = 0,
+    TERRAIN_NOISE_SIMPLEX,
+    TERRAIN_NOISE_VORONOI,
+} terrain_noise;
+
+/// @brief Fractal Brownian motion: a sum of octaves of a noise, each one finer and fainter than the last
+typedef struct FractalLayer {
+    terrain_noise noise;
+    uint octaves;
+    float frequency;    // Frequency of the first octave
+    float amplitude;    // Amplitude of the first octave
+    float lacunarity;   // Frequency multiplier between two octaves
+    float gain;         // Amplitude multiplier between two octaves
+    uint32 seed;        // Offsets every octave to an unrelated part of the noise
+} fbm_layer;
+
+/// @brief Maximum number of domain warp layers of a terrain generator
+#define TERRAIN_MAX_WARPS 4
+
+/// @brief Terrain generator: domain warp layers displacing the samples of a height layer
+typedef struct TerrainGenerator {
+    fbm_layer height;                   // Layer giving the height
+    fbm_layer warps[TERRAIN_MAX_WARPS]; // Domain warp layers, applied in order (their amplitude is the warp strength)
+    uint warpCount;
+    float pixelSize;                    // World size of a pixel
+    thread_pool* pool;                  // Pool running the tiles (NULL for the shared pool)
+} terrain_gen;
+
+/// @brief Create a fractal layer
+/// @param noise The noise to sum
+/// @param octaves The number of octaves
+/// @param seed The seed of the layer
+/// @return The newly created layer
+/// @note Frequency and amplitude start at 1, lacunarity is 2 and gain is 0.5
+fbm_layer createFbmLayer(terrain_noise noise, uint octaves, uint32 seed);
+
+/// @brief Evaluate a fractal layer in 2D
+/// @param layer The layer
+/// @param p The position
+/// @return The sum of the octaves
+float SL_fbm2D(const fbm_layer* layer, vec2 p);
+/// @brief Evaluate a fractal layer in 2D at many positions
+/// @param layer The layer
+/// @param p The positions
+/// @param count The number of positions
+/// @param destination Where the results are stored
+/// @note Set destination to NULL for new value
+/// @note Same values as SL_fbm2D, evaluated with the batch noises
+/// @return The destination value
+float* SL_fbm2D_Batch(const fbm_layer* layer, const vec2* p, uint count, float* restrict destination);
+
+/// @brief Create a terrain generator without any domain warp
+/// @param height The layer giving the height
+/// @param pixelSize The world size of a pixel
+/// @return The newly created terrain generator
+terrain_gen createTerrainGenerator(fbm_layer height, float pixelSize);
+/// @brief Add a domain warp layer to a terrain generator
+/// @param generator The terrain generator
+/// @param warp The warp layer, displacing the samples by its value along x and y (with two unrelated seeds)
+void terrainAddWarp(terrain_gen* generator, fbm_layer warp);
+
+/// @brief Generate a heightmap
+/// @param generator The terrain generator
+/// @param pixelOrigin The pixel coordinates of the first sample
+/// @param size The number of pixels along each axis
+/// @param destination Where the heights are stored (pixel (x, y) at index x + size.x * y)
+/// @note Set destination to NULL for new value
+/// @note Split in tiles run on the thread pool of the generator
+/// @note Every pixel only depends on its integer coordinates: results do not depend on the tiling or the thread count, and separately generated chunks match exactly on their borders
+/// @return The destination value
+float* terrainGenerate(const terrain_gen* generator, ivec2 pixelOrigin, uvec2 size, float* restrict destination);
+/// @brief Generate a single channel image of a heightmap
+/// @param generator The terrain generator
+/// @param pixelOrigin The pixel coordinates of the first sample
+/// @param size The number of pixels along each axis
+/// @param bitDepth The bit depth of the image: 8 (uint8), 16 (uint16) or 32 (raw float heights)
+/// @param low The height mapped to 0 (ignored for a bit depth of 32)
+/// @param high The height mapped to the highest value (ignored for a bit depth of 32)
+/// @return The newly created image
+image2D terrainGenerateImage(const terrain_gen* generator, ivec2 pixelOrigin, uvec2 size, uint8 bitDepth, float low, float high);
+
+#endif
\ No newline at end of file
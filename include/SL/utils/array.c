@@ -1,34 +1,569 @@
-#include "array.h"
-#include <stdlib.h>
-#include <memory.h>
-
-array(void)* __SL_newArray(size_t elemSize, uint capacity) {
-    array(void)* a = malloc(sizeof(array(void)));
-    a->count = 0;
-    a->capa = capacity;
-    a->data = malloc(capacity * elemSize);
-    return a;
-}
-void __SL_arrayCheckResize(array(void)* a, uint newCount, size_t elemSize) {
-    if (a->capa == 0) {
-        a->data = malloc(elemSize);
-        a->capa = elemSize;
-        return;
-    }
-    size_t needed = newCount * elemSize;
-    if (needed > a->capa) { // Count == capa
-        size_t newCapa = a->capa * 2;
-        while (needed > newCapa) newCapa *= 2;
-
-        void* newData = malloc(newCapa);
-        memcpy(newData, a->data, a->capa);
-        free(a->data);
-        a->data = newData;
-        a->capa = newCapa;
-    }
-}
-void __SL_arrayAddMultiple(array(void)* a, void* data, uint dataCount, size_t elemSize) {
-    __SL_arrayCheckResize(a, a->count + dataCount, elemSize);
-    memcpy(a->data + a->count * elemSize, data, dataCount * elemSize);
-    a->count += dataCount;
+#include "array.h"
+#include <stdlib.h>
+#include <stddef.h>
+#include <memory.h>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+#include "inout.h"
+#include "mappedArray.h"
+#include "../maths/math.h"
+
+// Alignment malloc always gives
+#define ARRAY_MALLOC_ALIGNMENT _Alignof(max_align_t)
+// Smallest capacity of a growing array, in elements
+#define ARRAY_MIN_CAPACITY 4
+
+void* __SL_arrayAllocate(size_t size, uint alignment) {
+    if (alignment <= ARRAY_MALLOC_ALIGNMENT) return calloc(size, 1);
+#ifdef _WIN32
+    void* data = _aligned_malloc(size ? size : 1, alignment);
+#else
+    void* data = NULL;
+    if (posix_memalign(&data, alignment, size ? size : 1)) data = NULL;
+#endif
+    if (data) memset(data, 0, size);
+    return data;
+}
+void __SL_arrayFreeData(void* data, uint alignment) {
+    if (alignment & ARRAY_INLINE_STORAGE) return;
+    if (alignment & ARRAY_MAPPED_STORAGE) { __SL_mappedArrayUnmap(data, alignment); return; }
+#ifdef _WIN32
+    if (alignment > ARRAY_MALLOC_ALIGNMENT) { _aligned_free(data); return; }
+#endif
+    free(data);
+}
+
+// Move the storage of an array to a new size, keeping its alignment
+static void arrayResize(array(void)* a, size_t size) {
+    void* data;
+    if (a->alignment & ARRAY_INLINE_STORAGE) {
+        // Inline storage never shrinks, and spills to the heap when it gets too small
+        if (size <= a->capa) return;
+        data = malloc(size);
+        if (!data) SL_throwError("INSUFFICIENT MEMORY - Failed to resize array to %llu bytes!", (unsigned long long)size);
+        memcpy(data, a->data, a->capa);
+        a->alignment = 0;
+        a->data = data;
+        a->capa = size;
+        return;
+    }
+    if (a->alignment & ARRAY_MAPPED_STORAGE) {
+        __SL_mappedArrayResize(a, size);
+        return;
+    }
+    if (a->alignment <= ARRAY_MALLOC_ALIGNMENT) data = realloc(a->data, size ? size : 1);
+    else {
+#ifdef _WIN32
+        data = _aligned_realloc(a->data, size ? size : 1, a->alignment);
+#else
+        // realloc keeps the offset of large blocks in their pages when it remaps them: only copy when the alignment is lost
+        data = realloc(a->data, size ? size : 1);
+        if (data && (uintptr_t)data % a->alignment) {
+            void* aligned = NULL;
+            if (posix_memalign(&aligned, a->alignment, size ? size : 1)) aligned = NULL;
+            if (aligned) memcpy(aligned, data, size);
+            free(data);
+            data = aligned;
+        }
+#endif
+    }
+    if (!data) SL_throwError("INSUFFICIENT MEMORY - Failed to resize array to %llu bytes!", (unsigned long long)size);
+    a->data = data;
+    a->capa = size;
+}
+
+array(void)* __SL_newArray(size_t elemSize, uint capacity) {
+    array(void)* a = malloc(sizeof(array(void)));
+    if (!a) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate array!");
+    a->count = 0;
+    a->alignment = 0;
+    a->capa = capacity * elemSize;
+    a->data = malloc(capacity * elemSize);
+    return a;
+}
+void* __SL_newSmallArray(size_t size, size_t storageOffset, size_t storageSize) {
+    array(void)* a = malloc(size);
+    if (!a) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate small array!");
+    a->data = (uint8*)a + storageOffset;
+    a->count = 0;
+    a->alignment = ARRAY_INLINE_STORAGE;
+    a->capa = storageSize;
+    return a;
+}
+void __SL_arrayCheckResize(array(void)* a, uint newCount, size_t elemSize) {
+    const size_t needed = (size_t)newCount * elemSize;
+    if (needed <= a->capa) return;
+
+    size_t newCapa = a->capa ? a->capa * 2 : ARRAY_MIN_CAPACITY * elemSize;
+    while (needed > newCapa) newCapa *= 2;
+    arrayResize(a, newCapa);
+}
+void __SL_arrayReserve(array(void)* a, uint capacity, size_t elemSize) {
+    const size_t needed = (size_t)capacity * elemSize;
+    if (needed > a->capa) arrayResize(a, needed);
+}
+void __SL_arrayShrinkToFit(array(void)* a, size_t elemSize) {
+    const size_t needed = (size_t)a->count * elemSize;
+    if (needed < a->capa) arrayResize(a, needed);
+}
+void __SL_arrayAddMultiple(array(void)* a, void* data, uint dataCount, size_t elemSize) {
+    __SL_arrayCheckResize(a, a->count + dataCount, elemSize);
+    memcpy(a->data + a->count * elemSize, data, dataCount * elemSize);
+    a->count += dataCount;
+}
+
+
+///// RADIX SORT
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define RADIX_BYTE(key, byte, keySize) ((key) * (keySize) + (keySize) - 1 - (byte))
+#else
+#define RADIX_BYTE(key, byte, keySize) ((key) * (keySize) + (byte))
+#endif
+
+// Signed integers: flipping the sign bit gives their order to the unsigned bits (the flip is its own inverse)
+#define RADIX_FLIP_SIGNED(type, n) do { \
+    type* k = (type*)data; \
+    for (size_t i = 0; i < n; i++) k[i] ^= (type)1 << (sizeof(type) * 8 - 1); \
+} while (0)
+// Floats: negative ones have all their bits flipped, positive ones only their sign bit
+#define RADIX_FLIP_FLOAT(type, n, toUnsigned) do { \
+    type* k = (type*)data; \
+    const type sign = (type)1 << (sizeof(type) * 8 - 1); \
+    if (toUnsigned) for (size_t i = 0; i < n; i++) k[i] ^= (k[i] & sign) ? ~(type)0 : sign; \
+    else            for (size_t i = 0; i < n; i++) k[i] ^= (k[i] & sign) ? sign : ~(type)0; \
+} while (0)
+
+static void radixFlip(void* data, size_t keyCount, size_t keySize, radix_key kind, bool toUnsigned) {
+    if (kind == RADIX_KEY_SIGNED) switch (keySize) {
+        case 1: RADIX_FLIP_SIGNED(uint8, keyCount); break;
+        case 2: RADIX_FLIP_SIGNED(uint16, keyCount); break;
+        case 4: RADIX_FLIP_SIGNED(uint32, keyCount); break;
+        case 8: RADIX_FLIP_SIGNED(uint64, keyCount); break;
+    }
+    else if (kind == RADIX_KEY_FLOAT) switch (keySize) {
+        case 4: RADIX_FLIP_FLOAT(uint32, keyCount, toUnsigned); break;
+        case 8: RADIX_FLIP_FLOAT(uint64, keyCount, toUnsigned); break;
+    }
+}
+
+// Constant sizes let the compiler turn the copies into plain moves
+#define RADIX_SCATTER(size) \
+    for (uint i = begin; i < end; i++) { \
+        const uint8* e = src + (size_t)i * (size); \
+        memcpy(dst + (size_t)offsets[e[byte]]++ * (size), e, (size)); \
+    }
+
+// Move the elements in [begin, end[ to the positions given by the offsets of their byte
+static void radixScatter(const uint8* src, uint8* dst, uint begin, uint end, size_t elemSize, size_t byte, uint32* offsets) {
+    switch (elemSize) {
+        case 1:  RADIX_SCATTER(1);  break;
+        case 2:  RADIX_SCATTER(2);  break;
+        case 4:  RADIX_SCATTER(4);  break;
+        case 8:  RADIX_SCATTER(8);  break;
+        case 12: RADIX_SCATTER(12); break;
+        case 16: RADIX_SCATTER(16); break;
+        case 24: RADIX_SCATTER(24); break;
+        case 32: RADIX_SCATTER(32); break;
+        default: RADIX_SCATTER(elemSize); break;
+    }
+}
+
+void __SL_arrayRadixSort(array(void)* a, size_t elemSize, size_t keySize, radix_key kind) {
+    if (a->count < 2) return;
+    const size_t keyCount = elemSize / keySize;
+    uint8* src = a->data;
+    uint8* dst = malloc(a->count * elemSize);
+    uint32 (*histograms)[256] = calloc(elemSize, sizeof(uint32[256]));
+    if (!dst || !histograms) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate radix sort buffers!");
+
+    radixFlip(src, a->count * keyCount, keySize, kind, true);
+
+    // Histograms of every byte at once, in a single read of the array
+    for (uint i = 0; i < a->count; i++) {
+        const uint8* e = src + (size_t)i * elemSize;
+        for (size_t b = 0; b < elemSize; b++) histograms[b][e[b]]++;
+    }
+
+    // One stable counting pass per byte, from the least significant byte of the last key
+    uint32 offsets[256];
+    for (size_t k = keyCount; k-- > 0;)
+    for (size_t b = 0; b < keySize; b++) {
+        const size_t byte = RADIX_BYTE(k, b, keySize);
+        const uint32* histogram = histograms[byte];
+        if (histogram[src[byte]] == a->count) continue; // Every element has the same byte: nothing to do
+
+        uint32 sum = 0;
+        for (uint v = 0; v < 256; v++) { offsets[v] = sum; sum += histogram[v]; }
+        radixScatter(src, dst, 0, a->count, elemSize, byte, offsets);
+        uint8* temp = src; src = dst; dst = temp;
+    }
+
+    if (src != (uint8*)a->data) {
+        memcpy(a->data, src, a->count * elemSize);
+        dst = src;
+    }
+    radixFlip(a->data, a->count * keyCount, keySize, kind, false);
+
+    free(dst);
+    free(histograms);
+}
+
+
+
+///// PARALLEL SORT
+
+// Below this many elements, sorting on one thread is faster than sharing the work
+#define PARALLEL_SORT_MIN 65536
+// Buckets of the sample sort per thread (more buckets balance the load better)
+#define PARALLEL_SORT_BUCKETS 8
+// Sampled elements per bucket
+#define PARALLEL_SORT_OVERSAMPLING 32
+
+typedef struct RadixJob {
+    uint8* src;
+    uint8* dst;
+    uint count;
+    uint chunkSize;
+    size_t elemSize, keySize;
+    radix_key kind;
+    bool toUnsigned;
+    size_t byte;                // byte of the current pass
+    uint32 (*histograms)[256];  // [chunk * elemSize + byte] when counting every byte, [chunk] for the current pass
+} radix_job;
+
+static void radixFlipTask(void* data, uint chunk) {
+    const radix_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    const size_t keyCount = job->elemSize / job->keySize;
+    radixFlip(job->src + (size_t)begin * job->elemSize, (size_t)(end - begin) * keyCount, job->keySize, job->kind, job->toUnsigned);
+}
+static void radixCountAllTask(void* data, uint chunk) {
+    const radix_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    uint32 (*histograms)[256] = job->histograms + (size_t)chunk * job->elemSize;
+    for (uint i = begin; i < end; i++) {
+        const uint8* e = job->src + (size_t)i * job->elemSize;
+        for (size_t b = 0; b < job->elemSize; b++) histograms[b][e[b]]++;
+    }
+}
+static void radixCountTask(void* data, uint chunk) {
+    const radix_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    uint32* histogram = job->histograms[chunk];
+    for (uint v = 0; v < 256; v++) histogram[v] = 0;
+    for (uint i = begin; i < end; i++) histogram[job->src[(size_t)i * job->elemSize + job->byte]]++;
+}
+static void radixScatterTask(void* data, uint chunk) {
+    const radix_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    radixScatter(job->src, job->dst, begin, end, job->elemSize, job->byte, job->histograms[chunk]);
+}
+
+void __SL_arrayRadixSort_Parallel(array(void)* a, size_t elemSize, size_t keySize, radix_key kind, thread_pool* pool) {
+    if (!pool) pool = SL_getThreadPool();
+    const uint threads = threadPoolGetThreadCount(pool);
+    if (threads == 1 || a->count < PARALLEL_SORT_MIN) {
+        __SL_arrayRadixSort(a, elemSize, keySize, kind);
+        return;
+    }
+
+    // One chunk per thread: every element of a chunk goes after those of the previous chunks with the same byte
+    const uint chunks = threads;
+    radix_job job = {
+        .src = a->data, .dst = malloc(a->count * elemSize),
+        .count = a->count, .chunkSize = (a->count + chunks - 1) / chunks,
+        .elemSize = elemSize, .keySize = keySize, .kind = kind, .toUnsigned = true,
+        .histograms = calloc((size_t)chunks * elemSize, sizeof(uint32[256]))
+    };
+    uint32 (*allHistograms)[256] = job.histograms;
+    uint32 (*passHistograms)[256] = malloc(chunks * sizeof(uint32[256]));
+    if (!job.dst || !job.histograms || !passHistograms) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate radix sort buffers!");
+
+    threadPoolRun(pool, radixFlipTask, &job, chunks);
+    threadPoolRun(pool, radixCountAllTask, &job, chunks);
+
+    bool first = true;
+    for (size_t k = elemSize / keySize; k-- > 0;)
+    for (size_t b = 0; b < keySize; b++) {
+        job.byte = RADIX_BYTE(k, b, keySize);
+        uint32 same = 0;
+        for (uint c = 0; c < chunks; c++) same += allHistograms[(size_t)c * elemSize + job.byte][job.src[job.byte]];
+        if (same == a->count) continue; // Every element has the same byte: nothing to do
+
+        // The histograms of every byte hold for the first pass only (before any element moved between chunks)
+        job.histograms = passHistograms;
+        if (first) for (uint c = 0; c < chunks; c++) memcpy(passHistograms[c], allHistograms[(size_t)c * elemSize + job.byte], sizeof(uint32[256]));
+        else threadPoolRun(pool, radixCountTask, &job, chunks);
+        first = false;
+
+        uint32 sum = 0;
+        for (uint v = 0; v < 256; v++)
+        for (uint c = 0; c < chunks; c++) {
+            const uint32 n = passHistograms[c][v];
+            passHistograms[c][v] = sum;
+            sum += n;
+        }
+        threadPoolRun(pool, radixScatterTask, &job, chunks);
+        uint8* temp = job.src; job.src = job.dst; job.dst = temp;
+    }
+
+    if (job.src != (uint8*)a->data) {
+        memcpy(a->data, job.src, a->count * elemSize);
+        job.dst = job.src;
+        job.src = a->data;
+    }
+    job.toUnsigned = false;
+    threadPoolRun(pool, radixFlipTask, &job, chunks);
+
+    free(job.dst);
+    free(allHistograms);
+    free(passHistograms);
+}
+
+typedef struct SampleSortJob {
+    uint8* data;
+    uint8* temp;
+    size_t elemSize;
+    uint count;
+    uint chunkSize;
+    uint bucketCount;
+    const uint8* splitters;     // bucketCount - 1 elements, in order
+    uint16* buckets;            // bucket of every element
+    size_t* offsets;            // [chunk * bucketCount + bucket]: element count, then where the next one goes in temp
+    size_t* bucketStarts;       // bucketCount + 1 positions in temp
+    func_sort_before before;
+    func_sort_range sortRange;
+} sample_sort_job;
+
+// Bucket of every element: the number of splitters not after it
+static void sampleSortClassifyTask(void* data, uint chunk) {
+    const sample_sort_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    size_t* counts = job->offsets + (size_t)chunk * job->bucketCount;
+    for (uint i = begin; i < end; i++) {
+        const uint8* e = job->data + (size_t)i * job->elemSize;
+        uint lo = 0, hi = job->bucketCount - 1;
+        while (lo < hi) {
+            const uint mid = (lo + hi) / 2;
+            if (job->before(e, job->splitters + (size_t)mid * job->elemSize)) hi = mid;
+            else lo = mid + 1;
+        }
+        job->buckets[i] = lo;
+        counts[lo]++;
+    }
+}
+static void sampleSortScatterTask(void* data, uint chunk) {
+    const sample_sort_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    size_t* offsets = job->offsets + (size_t)chunk * job->bucketCount;
+    for (uint i = begin; i < end; i++) memcpy(job->temp + offsets[job->buckets[i]]++ * job->elemSize, job->data + (size_t)i * job->elemSize, job->elemSize);
+}
+static void sampleSortBucketTask(void* data, uint bucket) {
+    const sample_sort_job* job = data;
+    const size_t begin = job->bucketStarts[bucket], count = job->bucketStarts[bucket + 1] - begin;
+    if (count) job->sortRange(job->temp + begin * job->elemSize, job->data + begin * job->elemSize, count);
+}
+
+void __SL_arraySort_Parallel(array(void)* a, size_t elemSize, thread_pool* pool, func_sort_before before, func_sort_range sortRange) {
+    if (a->count < 2) return;
+    if (!pool) pool = SL_getThreadPool();
+    const uint threads = threadPoolGetThreadCount(pool);
+
+    uint8* temp = malloc(a->count * elemSize);
+    if (!temp) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate sort buffer!");
+    if (threads == 1 || a->count < PARALLEL_SORT_MIN) {
+        memcpy(temp, a->data, a->count * elemSize);
+        sortRange(temp, a->data, a->count);
+        free(temp);
+        return;
+    }
+
+    uint bucketCount = threads * PARALLEL_SORT_BUCKETS;
+    if (bucketCount > 4096) bucketCount = 4096;
+    const uint chunks = threads * 4;
+    const uint sampleCount = bucketCount * PARALLEL_SORT_OVERSAMPLING;
+
+    sample_sort_job job = {
+        .data = a->data, .temp = temp, .elemSize = elemSize,
+        .count = a->count, .chunkSize = (a->count + chunks - 1) / chunks,
+        .bucketCount = bucketCount,
+        .buckets = malloc(a->count * sizeof(uint16)),
+        .offsets = calloc((size_t)chunks * bucketCount, sizeof(size_t)),
+        .bucketStarts = malloc((bucketCount + 1) * sizeof(size_t)),
+        .before = before, .sortRange = sortRange
+    };
+    uint8* samples = malloc((2 * (size_t)sampleCount + bucketCount) * elemSize);
+    if (!job.buckets || !job.offsets || !job.bucketStarts || !samples) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate sort buffers!");
+
+    // Splitters: evenly spaced elements of a sorted random sample
+    uint8* sorted = samples + (size_t)sampleCount * elemSize;
+    uint8* splitters = sorted + (size_t)sampleCount * elemSize;
+    for (uint i = 0; i < sampleCount; i++) {
+        const uint index = (uint)(((uint64)SL_PCGHash(i) * a->count) >> 32);
+        memcpy(samples + (size_t)i * elemSize, job.data + (size_t)index * elemSize, elemSize);
+    }
+    sortRange(samples, sorted, sampleCount);
+    for (uint b = 0; b < bucketCount - 1; b++) memcpy(splitters + (size_t)b * elemSize, sorted + (size_t)(b + 1) * PARALLEL_SORT_OVERSAMPLING * elemSize, elemSize);
+    job.splitters = splitters;
+
+    threadPoolRun(pool, sampleSortClassifyTask, &job, chunks);
+
+    // Each chunk moves its elements of a bucket after those of the previous chunks, which keeps the sort stable
+    size_t sum = 0;
+    for (uint b = 0; b < bucketCount; b++) {
+        job.bucketStarts[b] = sum;
+        for (uint c = 0; c < chunks; c++) {
+            const size_t n = job.offsets[(size_t)c * bucketCount + b];
+            job.offsets[(size_t)c * bucketCount + b] = sum;
+            sum += n;
+        }
+    }
+    job.bucketStarts[bucketCount] = sum;
+
+    threadPoolRun(pool, sampleSortScatterTask, &job, chunks);
+    threadPoolRun(pool, sampleSortBucketTask, &job, bucketCount);
+
+    free(samples);
+    free(job.buckets);
+    free(job.offsets);
+    free(job.bucketStarts);
+    free(temp);
+}
+
+///// PARALLEL PRIMITIVES
+
+// Smallest chunk of an automatic grain: below it, handing out the chunks costs more than the work
+#define PARALLEL_MIN_GRAIN 4096
+// Chunks of an automatic grain, whatever the number of threads, so that the chunks (and the order of a reduction)
+// only depend on the count: enough to balance the load of a few tens of threads
+#define PARALLEL_CHUNKS 64
+
+typedef struct ParallelJob {
+    const uint8* src;
+    uint8* dst;
+    uint count;
+    uint chunkSize;
+    size_t srcSize, dstSize;
+    void* data;
+    union {
+        func_for_range forRange;
+        func_map_range mapRange;
+        func_filter_range filterRange;
+        func_reduce_range reduceRange;
+    };
+    uint* kept;     // Elements kept by each chunk of a filter, then where they go
+} parallel_job;
+
+// Split the job into chunks, and return their number
+static uint parallelChunks(parallel_job* job, uint grain) {
+    if (!grain) {
+        grain = (job->count + PARALLEL_CHUNKS - 1) / PARALLEL_CHUNKS;
+        if (grain < PARALLEL_MIN_GRAIN) grain = PARALLEL_MIN_GRAIN;
+    }
+    job->chunkSize = grain;
+    return (uint)(((uint64)job->count + grain - 1) / grain);
+}
+// Run the tasks of a job, on the calling thread alone when there is a single one
+static void parallelRun(thread_pool* pool, func_task task, parallel_job* job, uint chunks) {
+    if (chunks == 1) task(job, 0);
+    else if (chunks) threadPoolRun(pool, task, job, chunks);
+}
+
+static void parallelForTask(void* data, uint chunk) {
+    const parallel_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    job->forRange(job->dst + (size_t)begin * job->dstSize, begin, end - begin, job->data);
+}
+void __SL_arrayFor_Parallel(array(void)* a, size_t elemSize, thread_pool* pool, uint grain, func_for_range forRange, void* data) {
+    if (!pool) pool = SL_getThreadPool();
+    parallel_job job = {.dst = a->data, .count = a->count, .dstSize = elemSize, .data = data, .forRange = forRange};
+    parallelRun(pool, parallelForTask, &job, parallelChunks(&job, grain));
+}
+
+static void parallelMapTask(void* data, uint chunk) {
+    const parallel_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    job->mapRange(job->src + (size_t)begin * job->srcSize, job->dst + (size_t)begin * job->dstSize, end - begin);
+}
+void __SL_arrayMap_Parallel(const array(void)* source, array(void)* destination, size_t sourceSize, size_t destinationSize, thread_pool* pool, uint grain, func_map_range mapRange) {
+    if (!pool) pool = SL_getThreadPool();
+    const uint count = source->count;
+    __SL_arrayReserve(destination, count, destinationSize);
+    parallel_job job = {.src = source->data, .dst = destination->data, .count = count, .srcSize = sourceSize, .dstSize = destinationSize, .mapRange = mapRange};
+    parallelRun(pool, parallelMapTask, &job, parallelChunks(&job, grain));
+    destination->count = count;
+}
+
+static void parallelFilterTask(void* data, uint chunk) {
+    const parallel_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    job->kept[chunk] = job->filterRange(job->src + (size_t)begin * job->srcSize, job->dst + (size_t)begin * job->srcSize, end - begin);
+}
+typedef struct FilterMoveJob {
+    const uint8* src;
+    uint8* dst;
+    size_t elemSize;
+    uint chunkSize;
+    const uint* kept;
+    const uint* offsets;
+} filter_move_job;
+static void parallelFilterMoveTask(void* data, uint chunk) {
+    const filter_move_job* job = data;
+    memcpy(job->dst + (size_t)job->offsets[chunk] * job->elemSize, job->src + (size_t)chunk * job->chunkSize * job->elemSize, (size_t)job->kept[chunk] * job->elemSize);
+}
+void __SL_arrayFilter_Parallel(const array(void)* source, array(void)* destination, size_t elemSize, thread_pool* pool, uint grain, func_filter_range filterRange) {
+    if (!pool) pool = SL_getThreadPool();
+    parallel_job job = {.src = source->data, .count = source->count, .srcSize = elemSize, .filterRange = filterRange};
+    const uint chunks = parallelChunks(&job, grain);
+    if (chunks <= 1) {
+        // A single chunk is compacted straight into the destination (the source stays readable when they are the same array)
+        __SL_arrayReserve(destination, job.count, elemSize);
+        destination->count = job.count ? filterRange(source->data, destination->data, job.count) : 0;
+        return;
+    }
+
+    // Each chunk compacts its kept elements at its own place of a scratch array, then they are all moved
+    // after those of the previous chunks (exclusive prefix sum of the kept counts), which keeps their order
+    job.dst = malloc((size_t)job.count * elemSize);
+    job.kept = malloc(2 * (size_t)chunks * sizeof(uint));
+    if (!job.dst || !job.kept) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate filter buffers!");
+    threadPoolRun(pool, parallelFilterTask, &job, chunks);
+
+    uint* offsets = job.kept + chunks;
+    uint sum = 0;
+    for (uint c = 0; c < chunks; c++) {
+        offsets[c] = sum;
+        sum += job.kept[c];
+    }
+    __SL_arrayReserve(destination, sum, elemSize);
+    filter_move_job move = {.src = job.dst, .dst = destination->data, .elemSize = elemSize, .chunkSize = job.chunkSize, .kept = job.kept, .offsets = offsets};
+    threadPoolRun(pool, parallelFilterMoveTask, &move, chunks);
+    destination->count = sum;
+
+    free(job.dst);
+    free(job.kept);
+}
+
+static void parallelReduceTask(void* data, uint chunk) {
+    const parallel_job* job = data;
+    const uint begin = chunk * job->chunkSize, end = job->count - begin < job->chunkSize ? job->count : begin + job->chunkSize;
+    job->reduceRange(job->src + (size_t)begin * job->srcSize, end - begin, job->dst + (size_t)chunk * job->dstSize);
+}
+void __SL_arrayReduce_Parallel(const array(void)* a, size_t elemSize, thread_pool* pool, uint grain, func_reduce_range reduceRange, void* result) {
+    if (!pool) pool = SL_getThreadPool();
+    parallel_job job = {.src = a->data, .count = a->count, .srcSize = elemSize, .dstSize = elemSize, .reduceRange = reduceRange};
+    const uint chunks = parallelChunks(&job, grain);
+    if (chunks <= 1) {
+        reduceRange(a->data, a->count, result);
+        return;
+    }
+
+    // The partial results are reduced in the order of the chunks: the result does not depend on the threads
+    job.dst = malloc((size_t)chunks * elemSize);
+    if (!job.dst) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate reduction buffer!");
+    threadPoolRun(pool, parallelReduceTask, &job, chunks);
+    reduceRange(job.dst, chunks, result);
+    free(job.dst);
 }
\ No newline at end of file
@@ -1,167 +1,611 @@
-#ifndef __SL_UTILS_ARRAY_H__
-#define __SL_UTILS_ARRAY_H__
-
-#include "../structures.h"
-
-#define __SL_DEFINE_ARRAY_0P(type, type_with_p_instead_of_stars_a) typedef struct type_with_p_instead_of_stars_a   { type* data;    uint count; size_t capa; }    type_with_p_instead_of_stars_a
-#define __SL_DEFINE_ARRAY_1P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type** data;   uint count; size_t capa; }   type_with_p_instead_of_stars##_a
-#define __SL_DEFINE_ARRAY_2P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type*** data;  uint count; size_t capa; }  type_with_p_instead_of_stars##_a
-#define __SL_DEFINE_ARRAY_3P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type**** data; uint count; size_t capa; } type_with_p_instead_of_stars##_a
-#define SL_DEFINE_ARRAY(type) \
-    __SL_DEFINE_ARRAY_0P (type, type##_a ); \
-    __SL_DEFINE_ARRAY_1P (type, type##p  ); \
-    __SL_DEFINE_ARRAY_2P (type, type##pp ); \
-    __SL_DEFINE_ARRAY_3P (type, type##ppp)
-
-#define array(type, ...) type##__VA_ARGS__##_a
-
-SL_DEFINE_ARRAY(void);
-
-/// @brief Type of an array element
-/// @param array_ The array
-#define __elemType(array_) typeof((array_).data[0])
-/// @brief Size of an array element
-/// @param array_ The array
-#define __elemSize(array_) sizeof(typeof((array_).data[0]))
-
-/// @brief Create an array ON STACK
-/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
-/// @param initialCapacity The initial capacity of the array (will use closest power of two above)
-/// @return The newly created array
-#define createArray(array_type, initialCapcity) ((array_type){.data = calloc(initialCapcity, sizeof(((array_type){0}).data[0])), .count = 0, .capa = initialCapcity * sizeof(((array_type){0}).data[0])})
-/// @brief Destroy an array
-/// @param toFree The array to destroy
-#define destroyArray(array) (free((array).data))
-/// @brief Create a new array ON HEAP
-/// @param elemSize The size of an array element
-/// @param initialCapacity The initial capacity of the array (will use closest power of two above)
-/// @return The newly created array
-/// @note Consider using "newArray" macro instead
-void_a* __SL_newArray(size_t elemSize, uint capacity);
-/// @brief Create a new array ON HEAP
-/// @param elemSize The size of an array element
-/// @param initialCapacity The initial capacity of the array (will use closest power of two above)
-/// @return The newly created array
-#define newArray(type, initialCapcity) ((array(type)*)__SL_newArray(sizeof(type), initialCapacity))
-/// @brief Free an array
-/// @param toFree The array to free
-#define freeArray(array) do { free((array)->data); free(array); }
-
-/// @brief Check and resize an array to be able to fit newCount elements
-/// @param array The array to check
-/// @param newCount The number of elements to accomodate
-/// @param elemSize The size of an array element
-/// @note Every function provided by the SL already calls this function when adding elements
-void __SL_arrayCheckResize(array(void)* array, uint newCount, size_t elemSize);
-/// @brief Add a C-array to the end of an array
-/// @param array The array to expand
-/// @param data The C-array to add
-/// @param dataCount The size of the C-array
-/// @param elemSize The size of an array element
-/// @note Consider using "arrayAdd", "arrayAdd_T" or "arrayAdd_M" macros instead
-void __SL_arrayAddMultiple(array(void)* array, void* data, uint dataCount, size_t elemSize);
-
-/// @brief Add an element to an array
-/// @param array_ The array to modify
-/// @param ... The value to add
-#define arrayAdd(array_, ...)  do { __SL_arrayCheckResize((void*)&(array_), (array_).count + 1,  __elemSize(array_));  (array_).data[(array_).count++]   = __VA_ARGS__; } while (0)
-/// @brief Add an element to an array
-/// @param array_ The array to modify
-/// @param ... The value to add
-#define arrayAdd_(array_, ...) do { __SL_arrayCheckResize((void*) (array_), (array_)->count + 1, __elemSize(*array_)); (array_)->data[(array_)->count++] = __VA_ARGS__; } while (0)
-
-/// @brief Add multiple elements to an array (C-array version)
-/// @param a The array to modify
-/// @param elements The elements to add
-/// @param count The number of elements to add
-#define arrayAdd_T(array_, elements, count)  __SL_arrayAddMultiple((void*)&(array_), elements, count, __elemSize(array_));
-/// @brief Add multiple elements to an array (C-array version)
-/// @param a The array to modify
-/// @param elements The elements to add
-/// @param count The number of elements to add
-#define arrayAdd_T_(array_, elements, count) __SL_arrayAddMultiple((void*)&(array_), elements, count, __elemSize(*array_));
-
-/// @brief Add multiple elements to an array (Variadic version)
-/// @param a The array to modify
-/// @param val0 The first element to add
-/// @param ... The rest of the elements to add
-#define arrayAdd_M(array_, val0, ...) do {  \
-    typeof((array_).data[0]) __SL_TEMP_ARRAY__[] = {val0, ##__VA_ARGS__}; \
-    const uint __SL_TEMP__ = sizeof(__SL_TEMP_ARRAY__) / __elemSize(array_); \
-    arrayAdd_T(array_, __SL_TEMP_ARRAY__, __SL_TEMP__); \
-} while(0)
-/// @brief Add multiple elements to an array (Variadic version)
-/// @param a The array to modify
-/// @param val0 The first element to add
-/// @param ... The rest of the elements to add
-#define arrayAdd_M_(array_, val0, ...) do {  \
-    typeof((array_)->data[0]) __SL_TEMP_ARRAY__[] = {val0, ##__VA_ARGS__}; \
-    const uint __SL_TEMP__ = sizeof(__SL_TEMP_ARRAY__) / __elemSize(*array_); \
-    arrayAdd_T_(array_, __SL_TEMP_ARRAY__, __SL_TEMP__); \
-} while(0)
-
-/// @brief Concatenate two arrays
-/// @param a The array to expand
-/// @param b The array to copy
-#define arrayCat(a, b)  arrayAdd_T(a, (b).data, (b).count)
-/// @brief Concatenate two arrays
-/// @param a The array to expand
-/// @param b The array to copy
-#define arrayCat_(a, b) arrayAdd_T_(a, (b)->data, (b)->count)
-
-/// @brief Pop last element of an array
-/// @param array The array
-#define arrayPop(array)  ((array).data[--(array).count])
-/// @brief Pop last element of an array
-/// @param array The array
-#define arrayPop_(array) ((array)->data[--(array)->count])
-
-/// @brief Get last element of an array
-/// @param array The array
-#define arrayLast(array)  ((array).data[(array).count - 1])
-/// @brief Get last element of an array
-/// @param array The array
-#define arrayLast_(array) ((array)->data[(array)->count - 1])
-
-/// @brief Get first element of an array
-/// @param array The array
-#define arrayFirst(array)  (*(array).data)
-/// @brief Get first element of an array
-/// @param array The array
-#define arrayFirst_(array) (*(array)->data)
-
-#define arrayWrap(carray, count) ((array(typeof(carray[0]))){.data = carray, .capa = count, .count = count})
-#define arrayWrap_Var(v0, ...) {.data = (typeof(v0)[]){v0, ##__VA_ARGS__}, .capa = sizeof((typeof(v0)[]){v0, ##__VA_ARGS__}) / sizeof(v0), .count = sizeof((typeof(v0)[]){v0, ##__VA_ARGS__}) / sizeof(v0)}
-
-#define arraySort(array, varA, varB, conditionOnAAndB) do { \
-    uvec2 __SL_ARRAY_STACK__[1024] = {0}; \
-    uint __SL_ARRAY_STACK_IDX__ = 1; \
-    __SL_ARRAY_STACK__[0] = Uvec2(0, (array).count - 1); \
-    do { \
-        uvec2 __SL_ARRAY_A_B__ = __SL_ARRAY_STACK__[--__SL_ARRAY_STACK_IDX__]; \
-        if (__SL_ARRAY_A_B__.x >= __SL_ARRAY_A_B__.y) continue; \
-        __elemType(array) varA = (array).data[__SL_ARRAY_A_B__.y]; \
-        uint __SL_ARRAY_J__ = __SL_ARRAY_A_B__.x; \
-        for (uint __SL_ARRAY_I__ = __SL_ARRAY_A_B__.x; __SL_ARRAY_I__ < __SL_ARRAY_A_B__.y; ++__SL_ARRAY_I__) { \
-            __elemType(array) varB = (array).data[__SL_ARRAY_I__]; \
-            if (conditionOnAAndB) { \
-                (array).data[__SL_ARRAY_I__] = (array).data[__SL_ARRAY_J__]; \
-                (array).data[__SL_ARRAY_J__] = varB; \
-                ++__SL_ARRAY_J__; \
-            } \
-        } \
-        (array).data[__SL_ARRAY_A_B__.y] = (array).data[__SL_ARRAY_J__]; \
-        (array).data[__SL_ARRAY_J__] = varA; \
-        \
-        if (__SL_ARRAY_J__ > 0) __SL_ARRAY_STACK__[__SL_ARRAY_STACK_IDX__++] = Uvec2(__SL_ARRAY_A_B__.x, __SL_ARRAY_J__ - 1); \
-        __SL_ARRAY_STACK__[__SL_ARRAY_STACK_IDX__++] = Uvec2(__SL_ARRAY_J__ + 1, __SL_ARRAY_A_B__.y); \
-    } while (__SL_ARRAY_STACK_IDX__); \
-} while (0);
-
-#define __SL_array_foreach(varname, array_) for (typeof((array_).data[0]) *varname = (array_).data, *varname##Max = (void*)(((size_t)(array_).data) + (array_).count * __elemSize(array_)); (size_t)varname < (size_t)varname##Max; ++varname)
-/// @brief Iterate over every element in array
-/// @param VARNAME_in_ARRAY Should litteraly the name of the variable used to iterate followed by "in" then the name of the array
-/// @note Use like a while-loop or a for-loop (as it is one)
-#define array_foreach(VARNAME_in_ARRAY) __SL_array_foreach(VARNAME_in_ARRAY)
-
+#ifndef __SL_UTILS_ARRAY_H__
+#define __SL_UTILS_ARRAY_H__
+
+#include "../structures.h"
+#include "threadPool.h"
+
+#define __SL_DEFINE_ARRAY_0P(type, type_with_p_instead_of_stars_a) typedef struct type_with_p_instead_of_stars_a   { type* data;    uint count; uint alignment; size_t capa; }    type_with_p_instead_of_stars_a
+#define __SL_DEFINE_ARRAY_1P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type** data;   uint count; uint alignment; size_t capa; }   type_with_p_instead_of_stars##_a
+#define __SL_DEFINE_ARRAY_2P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type*** data;  uint count; uint alignment; size_t capa; }  type_with_p_instead_of_stars##_a
+#define __SL_DEFINE_ARRAY_3P(type, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a { type**** data; uint count; uint alignment; size_t capa; } type_with_p_instead_of_stars##_a
+#define SL_DEFINE_ARRAY(type) \
+    __SL_DEFINE_ARRAY_0P (type, type##_a ); \
+    __SL_DEFINE_ARRAY_1P (type, type##p  ); \
+    __SL_DEFINE_ARRAY_2P (type, type##pp ); \
+    __SL_DEFINE_ARRAY_3P (type, type##ppp)
+
+#define array(type, ...) type##__VA_ARGS__##_a
+
+SL_DEFINE_ARRAY(void);
+
+/// @brief Type of an array element
+/// @param array_ The array
+#define __elemType(array_) typeof((array_).data[0])
+/// @brief Size of an array element
+/// @param array_ The array
+#define __elemSize(array_) sizeof(typeof((array_).data[0]))
+
+/// @brief Create an array ON STACK
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param initialCapacity The initial capacity of the array
+/// @return The newly created array
+#define createArray(array_type, initialCapcity) ((array_type){.data = calloc(initialCapcity, sizeof(((array_type){0}).data[0])), .count = 0, .capa = (initialCapcity) * sizeof(((array_type){0}).data[0])})
+/// @brief Create an array ON STACK whose storage is aligned, even after growing (for SIMD loads)
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param initialCapacity The initial capacity of the array
+/// @param alignment_ The alignment of the storage in bytes (power of two)
+/// @return The newly created array
+#define createArray_Aligned(array_type, initialCapcity, alignment_) ((array_type){.data = __SL_arrayAllocate((initialCapcity) * sizeof(((array_type){0}).data[0]), alignment_), .count = 0, .alignment = alignment_, .capa = (initialCapcity) * sizeof(((array_type){0}).data[0])})
+/// @brief Destroy an array
+/// @param toFree The array to destroy
+#define destroyArray(array) (__SL_arrayFreeData((array).data, (array).alignment))
+/// @brief Destroy an array
+/// @param toFree The array to destroy
+#define destroyArray_(array) (__SL_arrayFreeData((array)->data, (array)->alignment))
+/// @brief Create a new array ON HEAP
+/// @param elemSize The size of an array element
+/// @param initialCapacity The initial capacity of the array
+/// @return The newly created array
+/// @note Consider using "newArray" macro instead
+void_a* __SL_newArray(size_t elemSize, uint capacity);
+/// @brief Create a new array ON HEAP
+/// @param elemSize The size of an array element
+/// @param initialCapacity The initial capacity of the array
+/// @return The newly created array
+#define newArray(type, initialCapcity) ((array(type)*)__SL_newArray(sizeof(type), initialCapcity))
+/// @brief Free an array
+/// @param toFree The array to free
+#define freeArray(array) do { __SL_arrayFreeData((array)->data, (array)->alignment); free(array); } while (0)
+
+/// @brief Allocate the storage of an array
+/// @param size The size in bytes
+/// @param alignment The alignment in bytes (0 for the one of malloc)
+/// @return The zeroed storage
+/// @note Consider using "createArray_Aligned" macro instead
+void* __SL_arrayAllocate(size_t size, uint alignment);
+/// @brief Free the storage of an array
+/// @param data The storage
+/// @param alignment The alignment it was allocated with (nothing is freed for ARRAY_INLINE_STORAGE)
+/// @note Consider using "destroyArray" or "freeArray" macros instead
+void __SL_arrayFreeData(void* data, uint alignment);
+
+/// @brief Check and resize an array to be able to fit newCount elements
+/// @param array The array to check
+/// @param newCount The number of elements to accomodate
+/// @param elemSize The size of an array element
+/// @note Every function provided by the SL already calls this function when adding elements
+/// @note Grows by doubling the capacity, through realloc: large arrays are moved by remapping their pages rather than copying them (where the C library supports it)
+void __SL_arrayCheckResize(array(void)* array, uint newCount, size_t elemSize);
+/// @brief Set the capacity of an array to exactly fit a number of elements, if it is not already larger
+/// @param array The array
+/// @param capacity The number of elements to fit
+/// @param elemSize The size of an array element
+/// @note Consider using "arrayReserve" macro instead
+void __SL_arrayReserve(array(void)* array, uint capacity, size_t elemSize);
+/// @brief Set the capacity of an array to its number of elements, giving the rest back to the system
+/// @param array The array
+/// @param elemSize The size of an array element
+/// @note Consider using "arrayShrinkToFit" macro instead
+void __SL_arrayShrinkToFit(array(void)* array, size_t elemSize);
+
+/// @brief Make room for a number of elements in an array, so that adding them does not grow it again
+/// @param array_ The array
+/// @param capacity The number of elements to fit
+#define arrayReserve(array_, capacity)  __SL_arrayReserve((void*)&(array_), capacity, __elemSize(array_))
+/// @brief Make room for a number of elements in an array, so that adding them does not grow it again
+/// @param array_ The array
+/// @param capacity The number of elements to fit
+#define arrayReserve_(array_, capacity) __SL_arrayReserve((void*) (array_), capacity, __elemSize(*array_))
+/// @brief Free the unused capacity of an array
+/// @param array_ The array
+#define arrayShrinkToFit(array_)  __SL_arrayShrinkToFit((void*)&(array_), __elemSize(array_))
+/// @brief Free the unused capacity of an array
+/// @param array_ The array
+#define arrayShrinkToFit_(array_) __SL_arrayShrinkToFit((void*) (array_), __elemSize(*array_))
+
+/// @brief Add a C-array to the end of an array
+/// @param array The array to expand
+/// @param data The C-array to add
+/// @param dataCount The size of the C-array
+/// @param elemSize The size of an array element
+/// @note Consider using "arrayAdd", "arrayAdd_T" or "arrayAdd_M" macros instead
+void __SL_arrayAddMultiple(array(void)* array, void* data, uint dataCount, size_t elemSize);
+
+/// @brief Add an element to an array
+/// @param array_ The array to modify
+/// @param ... The value to add
+#define arrayAdd(array_, ...)  do { if (((size_t)(array_).count + 1) * __elemSize(array_) > (array_).capa)   __SL_arrayCheckResize((void*)&(array_), (array_).count + 1,  __elemSize(array_));  (array_).data[(array_).count++]   = __VA_ARGS__; } while (0)
+/// @brief Add an element to an array
+/// @param array_ The array to modify
+/// @param ... The value to add
+#define arrayAdd_(array_, ...) do { if (((size_t)(array_)->count + 1) * __elemSize(*array_) > (array_)->capa) __SL_arrayCheckResize((void*) (array_), (array_)->count + 1, __elemSize(*array_)); (array_)->data[(array_)->count++] = __VA_ARGS__; } while (0)
+
+/// @brief Add multiple elements to an array (C-array version)
+/// @param a The array to modify
+/// @param elements The elements to add
+/// @param count The number of elements to add
+#define arrayAdd_T(array_, elements, count)  __SL_arrayAddMultiple((void*)&(array_), elements, count, __elemSize(array_));
+/// @brief Add multiple elements to an array (C-array version)
+/// @param a The array to modify
+/// @param elements The elements to add
+/// @param count The number of elements to add
+#define arrayAdd_T_(array_, elements, count) __SL_arrayAddMultiple((void*) (array_), elements, count, __elemSize(*array_));
+
+/// @brief Add multiple elements to an array (Variadic version)
+/// @param a The array to modify
+/// @param val0 The first element to add
+/// @param ... The rest of the elements to add
+#define arrayAdd_M(array_, val0, ...) do {  \
+    typeof((array_).data[0]) __SL_TEMP_ARRAY__[] = {val0, ##__VA_ARGS__}; \
+    const uint __SL_TEMP__ = sizeof(__SL_TEMP_ARRAY__) / __elemSize(array_); \
+    arrayAdd_T(array_, __SL_TEMP_ARRAY__, __SL_TEMP__); \
+} while(0)
+/// @brief Add multiple elements to an array (Variadic version)
+/// @param a The array to modify
+/// @param val0 The first element to add
+/// @param ... The rest of the elements to add
+#define arrayAdd_M_(array_, val0, ...) do {  \
+    typeof((array_)->data[0]) __SL_TEMP_ARRAY__[] = {val0, ##__VA_ARGS__}; \
+    const uint __SL_TEMP__ = sizeof(__SL_TEMP_ARRAY__) / __elemSize(*array_); \
+    arrayAdd_T_(array_, __SL_TEMP_ARRAY__, __SL_TEMP__); \
+} while(0)
+
+/// @brief Concatenate two arrays
+/// @param a The array to expand
+/// @param b The array to copy
+#define arrayCat(a, b)  arrayAdd_T(a, (b).data, (b).count)
+/// @brief Concatenate two arrays
+/// @param a The array to expand
+/// @param b The array to copy
+#define arrayCat_(a, b) arrayAdd_T_(a, (b)->data, (b)->count)
+
+/// @brief Pop last element of an array
+/// @param array The array
+#define arrayPop(array)  ((array).data[--(array).count])
+/// @brief Pop last element of an array
+/// @param array The array
+#define arrayPop_(array) ((array)->data[--(array)->count])
+
+/// @brief Get last element of an array
+/// @param array The array
+#define arrayLast(array)  ((array).data[(array).count - 1])
+/// @brief Get last element of an array
+/// @param array The array
+#define arrayLast_(array) ((array)->data[(array)->count - 1])
+
+/// @brief Get first element of an array
+/// @param array The array
+#define arrayFirst(array)  (*(array).data)
+/// @brief Get first element of an array
+/// @param array The array
+#define arrayFirst_(array) (*(array)->data)
+
+#define arrayWrap(carray, count) ((array(typeof(carray[0]))){.data = carray, .capa = (count) * sizeof(carray[0]), .count = count})
+#define arrayWrap_Var(v0, ...) {.data = (typeof(v0)[]){v0, ##__VA_ARGS__}, .capa = sizeof((typeof(v0)[]){v0, ##__VA_ARGS__}), .count = sizeof((typeof(v0)[]){v0, ##__VA_ARGS__}) / sizeof(v0)}
+
+///// SMALL ARRAY
+
+// A small array starts like array(T), followed by room for N elements: its data points to that room until it
+// holds more than N elements, then it moves to the heap like any array. Every array macro works on it unchanged.
+// As data points inside the struct, a small array must not be copied by value while its storage is inline.
+
+/// @brief Flag set in the alignment of an array whose storage is inline (never freed nor reallocated)
+#define ARRAY_INLINE_STORAGE 0x80000000u
+
+#define __SL_DEFINE_SMALL_ARRAY_0P(type, N, type_with_p_instead_of_stars_a) typedef struct type_with_p_instead_of_stars_a##N   { type* data;    uint count; uint alignment; size_t capa; type storage[N];    } type_with_p_instead_of_stars_a##N
+#define __SL_DEFINE_SMALL_ARRAY_1P(type, N, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a##N { type** data;   uint count; uint alignment; size_t capa; type* storage[N];   } type_with_p_instead_of_stars##_a##N
+#define __SL_DEFINE_SMALL_ARRAY_2P(type, N, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a##N { type*** data;  uint count; uint alignment; size_t capa; type** storage[N];  } type_with_p_instead_of_stars##_a##N
+#define __SL_DEFINE_SMALL_ARRAY_3P(type, N, type_with_p_instead_of_stars)   typedef struct type_with_p_instead_of_stars##_a##N { type**** data; uint count; uint alignment; size_t capa; type*** storage[N]; } type_with_p_instead_of_stars##_a##N
+#define SL_DEFINE_SMALL_ARRAY(type, N) \
+    __SL_DEFINE_SMALL_ARRAY_0P (type, N, type##_a ); \
+    __SL_DEFINE_SMALL_ARRAY_1P (type, N, type##p  ); \
+    __SL_DEFINE_SMALL_ARRAY_2P (type, N, type##pp ); \
+    __SL_DEFINE_SMALL_ARRAY_3P (type, N, type##ppp)
+
+#define smallArray(type, N, ...) type##__VA_ARGS__##_a##N
+
+/// @brief Initialize a small array in place (on stack or inside another struct), with its storage inline
+/// @param array_ The small array (Use "smallArray(type, N)" with the type of the element to store)
+/// @note Destroy it with "destroyArray"
+#define initSmallArray(array_)  ((array_).data = (array_).storage,   (array_).count = 0,   (array_).alignment = ARRAY_INLINE_STORAGE,   (array_).capa = sizeof((array_).storage))
+/// @brief Initialize a small array in place (on stack or inside another struct), with its storage inline
+/// @param array_ The small array (Use "smallArray(type, N)" with the type of the element to store)
+/// @note Destroy it with "destroyArray_"
+#define initSmallArray_(array_) ((array_)->data = (array_)->storage, (array_)->count = 0, (array_)->alignment = ARRAY_INLINE_STORAGE, (array_)->capa = sizeof((array_)->storage))
+/// @brief Create a new small array ON HEAP
+/// @param array_type The type of the small array (Use "smallArray(type, N)" with the type of the element to store)
+/// @return The newly created small array
+/// @note Free it with "freeArray"
+#define newSmallArray(array_type) ((array_type*)__SL_newSmallArray(sizeof(array_type), __builtin_offsetof(array_type, storage), sizeof(((array_type){0}).storage)))
+/// @brief Create a new small array ON HEAP
+/// @param size The size of the small array struct
+/// @param storageOffset The offset of its inline storage
+/// @param storageSize The size of its inline storage
+/// @return The newly created small array
+/// @note Consider using "newSmallArray" macro instead
+void* __SL_newSmallArray(size_t size, size_t storageOffset, size_t storageSize);
+/// @brief Check whether the storage of an array is inline
+/// @param array_ The array
+#define arrayIsInline(array_)  (((array_).alignment & ARRAY_INLINE_STORAGE) != 0)
+/// @brief Check whether the storage of an array is inline
+/// @param array_ The array
+#define arrayIsInline_(array_) (((array_)->alignment & ARRAY_INLINE_STORAGE) != 0)
+
+// Ranges of at most this many elements are finished by insertion sort
+#define __SL_ARRAY_SORT_INSERTION 16
+/// @brief Evaluate the sorting condition of arraySort on two elements
+/// @note Sets result to true when "before" must be placed before "after"
+#define __SL_arraySortBefore(result, varA, varB, conditionOnAAndB, before, after) do { \
+    typeof(__SL_SORT_DATA__[0]) varA = (after); \
+    typeof(__SL_SORT_DATA__[0]) varB = (before); \
+    result = (conditionOnAAndB); \
+} while (0)
+#define __SL_arraySortSwap(i, j) do { \
+    typeof(__SL_SORT_DATA__[0]) __SL_SORT_TEMP__ = __SL_SORT_DATA__[i]; \
+    __SL_SORT_DATA__[i] = __SL_SORT_DATA__[j]; \
+    __SL_SORT_DATA__[j] = __SL_SORT_TEMP__; \
+} while (0)
+
+/// @brief Sort an array (introsort: quicksort with median of three pivots, insertion sort for small ranges, and heapsort for ranges partitioned too many times)
+/// @param array_ The array to sort
+/// @param varA The name given to the first element compared by the condition
+/// @param varB The name given to the second element compared by the condition
+/// @param conditionOnAAndB The condition, true when varB must be placed before varA (use "varB < varA" to sort in increasing order)
+/// @note O(n log(n)) in the worst case, using no memory allocation
+/// @note Not stable: equal elements may be reordered
+#define arraySort(array_, varA, varB, conditionOnAAndB) do { \
+    typeof((array_).data[0])* const __SL_SORT_DATA__ = (array_).data; \
+    uint __SL_SORT_STACK__[32][3]; \
+    uint __SL_SORT_TOP__ = 0, __SL_SORT_LO__ = 0, __SL_SORT_HI__ = (array_).count, __SL_SORT_BUDGET__ = 0; \
+    for (uint __SL_SORT_N__ = __SL_SORT_HI__; __SL_SORT_N__ > 1; __SL_SORT_N__ >>= 1) __SL_SORT_BUDGET__ += 2; \
+    while (true) { \
+        const uint __SL_SORT_SIZE__ = __SL_SORT_HI__ - __SL_SORT_LO__; \
+        bool __SL_SORT_BEFORE__; \
+        if (__SL_SORT_SIZE__ <= __SL_ARRAY_SORT_INSERTION) { \
+            for (uint __SL_SORT_I__ = __SL_SORT_LO__ + 1; __SL_SORT_I__ < __SL_SORT_HI__; __SL_SORT_I__++) { \
+                typeof(__SL_SORT_DATA__[0]) __SL_SORT_ELEM__ = __SL_SORT_DATA__[__SL_SORT_I__]; \
+                uint __SL_SORT_J__ = __SL_SORT_I__; \
+                for (; __SL_SORT_J__ > __SL_SORT_LO__; __SL_SORT_J__--) { \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_ELEM__, __SL_SORT_DATA__[__SL_SORT_J__ - 1]); \
+                    if (!__SL_SORT_BEFORE__) break; \
+                    __SL_SORT_DATA__[__SL_SORT_J__] = __SL_SORT_DATA__[__SL_SORT_J__ - 1]; \
+                } \
+                __SL_SORT_DATA__[__SL_SORT_J__] = __SL_SORT_ELEM__; \
+            } \
+        } else if (__SL_SORT_BUDGET__ == 0) { \
+            /* Heapsort: build a max heap, then move its root to the end until it is empty */ \
+            for (uint __SL_SORT_START__ = __SL_SORT_SIZE__ / 2, __SL_SORT_END__ = __SL_SORT_SIZE__; __SL_SORT_END__ > 1;) { \
+                if (__SL_SORT_START__ > 0) __SL_SORT_START__--; \
+                else { __SL_SORT_END__--; __SL_arraySortSwap(__SL_SORT_LO__, __SL_SORT_LO__ + __SL_SORT_END__); } \
+                uint __SL_SORT_ROOT__ = __SL_SORT_START__, __SL_SORT_CHILD__; \
+                while ((__SL_SORT_CHILD__ = 2 * __SL_SORT_ROOT__ + 1) < __SL_SORT_END__) { \
+                    if (__SL_SORT_CHILD__ + 1 < __SL_SORT_END__) { \
+                        __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_LO__ + __SL_SORT_CHILD__], __SL_SORT_DATA__[__SL_SORT_LO__ + __SL_SORT_CHILD__ + 1]); \
+                        __SL_SORT_CHILD__ += __SL_SORT_BEFORE__; \
+                    } \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_LO__ + __SL_SORT_ROOT__], __SL_SORT_DATA__[__SL_SORT_LO__ + __SL_SORT_CHILD__]); \
+                    if (!__SL_SORT_BEFORE__) break; \
+                    __SL_arraySortSwap(__SL_SORT_LO__ + __SL_SORT_ROOT__, __SL_SORT_LO__ + __SL_SORT_CHILD__); \
+                    __SL_SORT_ROOT__ = __SL_SORT_CHILD__; \
+                } \
+            } \
+        } else { \
+            __SL_SORT_BUDGET__--; \
+            /* Median of the second, middle and last elements as pivot, moved to the first place (sorting network on their indices) */ \
+            uint __SL_SORT_M__[3] = {__SL_SORT_LO__ + 1, __SL_SORT_LO__ + __SL_SORT_SIZE__ / 2, __SL_SORT_HI__ - 1}; \
+            for (uint __SL_SORT_K__ = 0; __SL_SORT_K__ < 3; __SL_SORT_K__++) { \
+                const uint __SL_SORT_P__ = __SL_SORT_K__ & 1; \
+                __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_M__[__SL_SORT_P__ + 1]], __SL_SORT_DATA__[__SL_SORT_M__[__SL_SORT_P__]]); \
+                if (__SL_SORT_BEFORE__) { const uint __SL_SORT_T__ = __SL_SORT_M__[__SL_SORT_P__]; __SL_SORT_M__[__SL_SORT_P__] = __SL_SORT_M__[__SL_SORT_P__ + 1]; __SL_SORT_M__[__SL_SORT_P__ + 1] = __SL_SORT_T__; } \
+            } \
+            __SL_arraySortSwap(__SL_SORT_LO__, __SL_SORT_M__[1]); \
+            /* Hoare partition: the smallest and largest of the three stop the scans without bound checks */ \
+            uint __SL_SORT_I__ = __SL_SORT_LO__ + 1, __SL_SORT_J__ = __SL_SORT_HI__; \
+            while (true) { \
+                while (true) { \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_I__], __SL_SORT_DATA__[__SL_SORT_LO__]); \
+                    if (!__SL_SORT_BEFORE__) break; \
+                    __SL_SORT_I__++; \
+                } \
+                while (true) { \
+                    __SL_SORT_J__--; \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_LO__], __SL_SORT_DATA__[__SL_SORT_J__]); \
+                    if (!__SL_SORT_BEFORE__) break; \
+                } \
+                if (__SL_SORT_I__ >= __SL_SORT_J__) break; \
+                __SL_arraySortSwap(__SL_SORT_I__, __SL_SORT_J__); \
+                __SL_SORT_I__++; \
+            } \
+            /* Keep going with the smaller side, so the stack never holds more than log2(count) ranges */ \
+            if (__SL_SORT_I__ - __SL_SORT_LO__ < __SL_SORT_HI__ - __SL_SORT_I__) { \
+                __SL_SORT_STACK__[__SL_SORT_TOP__][0] = __SL_SORT_I__; \
+                __SL_SORT_STACK__[__SL_SORT_TOP__][1] = __SL_SORT_HI__; \
+                __SL_SORT_HI__ = __SL_SORT_I__; \
+            } else { \
+                __SL_SORT_STACK__[__SL_SORT_TOP__][0] = __SL_SORT_LO__; \
+                __SL_SORT_STACK__[__SL_SORT_TOP__][1] = __SL_SORT_I__; \
+                __SL_SORT_LO__ = __SL_SORT_I__; \
+            } \
+            __SL_SORT_STACK__[__SL_SORT_TOP__++][2] = __SL_SORT_BUDGET__; \
+            continue; \
+        } \
+        if (!__SL_SORT_TOP__) break; \
+        __SL_SORT_TOP__--; \
+        __SL_SORT_LO__ = __SL_SORT_STACK__[__SL_SORT_TOP__][0]; \
+        __SL_SORT_HI__ = __SL_SORT_STACK__[__SL_SORT_TOP__][1]; \
+        __SL_SORT_BUDGET__ = __SL_SORT_STACK__[__SL_SORT_TOP__][2]; \
+    } \
+} while (0)
+
+/// @brief Kind of the keys sorted by radix sort
+typedef enum RadixKey {
+    RADIX_KEY_UNSIGNED = 0,
+    RADIX_KEY_SIGNED,
+    RADIX_KEY_FLOAT,
+} radix_key;
+/// @brief Sort an array by radix sort (least significant digit first)
+/// @param array The array to sort
+/// @param elemSize The size of an array element
+/// @param keySize The size of a key (1, 2, 4 or 8 bytes)
+/// @param kind The kind of the keys
+/// @note Elements are made of elemSize / keySize keys, sorted in lexicographic order (first key first)
+/// @note Consider using "arrayRadixSort" macro instead
+void __SL_arrayRadixSort(array(void)* array, size_t elemSize, size_t keySize, radix_key kind);
+/// @brief Sort an array by radix sort on a thread pool
+/// @param array The array to sort
+/// @param elemSize The size of an array element
+/// @param keySize The size of a key (1, 2, 4 or 8 bytes)
+/// @param kind The kind of the keys
+/// @param pool The thread pool (NULL for the shared one)
+/// @note Consider using "arrayRadixSort_Parallel" macro instead
+void __SL_arrayRadixSort_Parallel(array(void)* array, size_t elemSize, size_t keySize, radix_key kind, thread_pool* pool);
+
+
+///// PARALLEL SORT
+
+/// @brief Ordering of a parallel sort
+/// @param before The first element
+/// @param after The second element
+/// @return Whether "before" must be placed before "after"
+typedef bool (*func_sort_before)(const void* before, const void* after);
+/// @brief Sort of a part of the array by a parallel sort
+/// @param source The elements to sort (used as scratch memory)
+/// @param destination Where the sorted elements are stored (does not overlap source)
+/// @param count The number of elements
+typedef void (*func_sort_range)(void* source, void* destination, uint count);
+
+/// @brief Sort an array on a thread pool (sample sort)
+/// @param array The array to sort
+/// @param elemSize The size of an array element
+/// @param pool The thread pool (NULL for the shared one)
+/// @param before The ordering
+/// @param sortRange The sort of each bucket (stable for a stable sort)
+/// @note Consider using "SL_DEFINE_ARRAY_SORT" macro instead
+void __SL_arraySort_Parallel(array(void)* array, size_t elemSize, thread_pool* pool, func_sort_before before, func_sort_range sortRange);
+
+// Runs merged by the stable sort start as insertion sorted runs of this many elements
+#define __SL_ARRAY_SORT_RUN 16
+
+/// @brief Define parallel sorts for a type of array, with the same condition as arraySort
+/// @param name The name of the unstable sort ("name##_Stable" is the stable one)
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param varA The name given to the first element compared by the condition
+/// @param varB The name given to the second element compared by the condition
+/// @param conditionOnAAndB The condition, true when varB must be placed before varA (can only use varA, varB and globals)
+/// @note Defines "static void name(array_type* array, thread_pool* pool)" and "static void name##_Stable(array_type* array, thread_pool* pool)", which take NULL for the shared thread pool
+/// @note Splits the array into buckets between sampled elements, moves every element to its bucket, then sorts the buckets in parallel (introsort, or merge sort when stable): allocates a copy of the array
+/// @note Arrays with many equal elements scale less, as each value goes to a single bucket
+#define SL_DEFINE_ARRAY_SORT(name, array_type, varA, varB, conditionOnAAndB) \
+    typedef typeof(((array_type){0}).data[0]) name##__elem; \
+    static bool name##__Before(const void* __SL_SORT_BEFORE_PTR__, const void* __SL_SORT_AFTER_PTR__) { \
+        name##__elem varA = *(const name##__elem*)__SL_SORT_AFTER_PTR__; \
+        name##__elem varB = *(const name##__elem*)__SL_SORT_BEFORE_PTR__; \
+        return (conditionOnAAndB); \
+    } \
+    static void name##__Range(void* source, void* destination, uint count) { \
+        struct { name##__elem* data; uint count; } __SL_SORT_RANGE__ = {source, count}; \
+        arraySort(__SL_SORT_RANGE__, varA, varB, conditionOnAAndB); \
+        for (uint __SL_SORT_I__ = 0; __SL_SORT_I__ < count; __SL_SORT_I__++) ((name##__elem*)destination)[__SL_SORT_I__] = ((name##__elem*)source)[__SL_SORT_I__]; \
+    } \
+    static void name##__RangeStable(void* source, void* destination, uint count) { \
+        name##__elem* in = source; \
+        name##__elem* out = destination; \
+        /* The runs are sorted where the merges must start for the last one to end in destination */ \
+        uint __SL_SORT_PASSES__ = 0; \
+        for (size_t __SL_SORT_W__ = __SL_ARRAY_SORT_RUN; __SL_SORT_W__ < count; __SL_SORT_W__ *= 2) __SL_SORT_PASSES__++; \
+        if (!(__SL_SORT_PASSES__ & 1)) { \
+            for (uint __SL_SORT_I__ = 0; __SL_SORT_I__ < count; __SL_SORT_I__++) out[__SL_SORT_I__] = in[__SL_SORT_I__]; \
+            in = destination; \
+            out = source; \
+        } \
+        bool __SL_SORT_BEFORE__; \
+        for (uint __SL_SORT_LO__ = 0; __SL_SORT_LO__ < count; __SL_SORT_LO__ += __SL_ARRAY_SORT_RUN) { \
+            name##__elem* const __SL_SORT_DATA__ = in + __SL_SORT_LO__; \
+            const uint __SL_SORT_N__ = count - __SL_SORT_LO__ < __SL_ARRAY_SORT_RUN ? count - __SL_SORT_LO__ : __SL_ARRAY_SORT_RUN; \
+            for (uint __SL_SORT_I__ = 1; __SL_SORT_I__ < __SL_SORT_N__; __SL_SORT_I__++) { \
+                name##__elem __SL_SORT_ELEM__ = __SL_SORT_DATA__[__SL_SORT_I__]; \
+                uint __SL_SORT_J__ = __SL_SORT_I__; \
+                for (; __SL_SORT_J__ > 0; __SL_SORT_J__--) { \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_ELEM__, __SL_SORT_DATA__[__SL_SORT_J__ - 1]); \
+                    if (!__SL_SORT_BEFORE__) break; \
+                    __SL_SORT_DATA__[__SL_SORT_J__] = __SL_SORT_DATA__[__SL_SORT_J__ - 1]; \
+                } \
+                __SL_SORT_DATA__[__SL_SORT_J__] = __SL_SORT_ELEM__; \
+            } \
+        } \
+        /* Merges: an element of the right run only goes first when strictly before, which keeps equal elements in order */ \
+        for (size_t __SL_SORT_W__ = __SL_ARRAY_SORT_RUN; __SL_SORT_W__ < count; __SL_SORT_W__ *= 2) { \
+            name##__elem* const __SL_SORT_DATA__ = in; \
+            for (size_t __SL_SORT_LO__ = 0; __SL_SORT_LO__ < count; __SL_SORT_LO__ += 2 * __SL_SORT_W__) { \
+                const size_t __SL_SORT_MID__ = __SL_SORT_LO__ + __SL_SORT_W__ < count ? __SL_SORT_LO__ + __SL_SORT_W__ : count; \
+                const size_t __SL_SORT_HI__ = __SL_SORT_LO__ + 2 * __SL_SORT_W__ < count ? __SL_SORT_LO__ + 2 * __SL_SORT_W__ : count; \
+                size_t __SL_SORT_I__ = __SL_SORT_LO__, __SL_SORT_J__ = __SL_SORT_MID__, __SL_SORT_K__ = __SL_SORT_LO__; \
+                while (__SL_SORT_I__ < __SL_SORT_MID__ && __SL_SORT_J__ < __SL_SORT_HI__) { \
+                    __SL_arraySortBefore(__SL_SORT_BEFORE__, varA, varB, conditionOnAAndB, __SL_SORT_DATA__[__SL_SORT_J__], __SL_SORT_DATA__[__SL_SORT_I__]); \
+                    out[__SL_SORT_K__++] = __SL_SORT_BEFORE__ ? in[__SL_SORT_J__++] : in[__SL_SORT_I__++]; \
+                } \
+                while (__SL_SORT_I__ < __SL_SORT_MID__) out[__SL_SORT_K__++] = in[__SL_SORT_I__++]; \
+                while (__SL_SORT_J__ < __SL_SORT_HI__)  out[__SL_SORT_K__++] = in[__SL_SORT_J__++]; \
+            } \
+            name##__elem* const __SL_SORT_SWAP__ = in; \
+            in = out; \
+            out = __SL_SORT_SWAP__; \
+        } \
+    } \
+    static void name(array_type* array, thread_pool* pool)         { __SL_arraySort_Parallel((void*)array, sizeof(name##__elem), pool, name##__Before, name##__Range); } \
+    static void name##_Stable(array_type* array, thread_pool* pool) { __SL_arraySort_Parallel((void*)array, sizeof(name##__elem), pool, name##__Before, name##__RangeStable); }
+
+
+///// PARALLEL PRIMITIVES
+
+// The array is cut into chunks of "grain" consecutive elements, handed out to the threads of the pool one at a time.
+// A grain of 0 cuts the array into 64 chunks of at least a few thousand elements, whatever the number of threads, and
+// a single chunk runs on the calling thread alone. Use a smaller grain when every element is a lot of work, for a better balance.
+
+/// @brief Work of a parallel for on a chunk of an array
+/// @param elements The first element of the chunk
+/// @param first The index of the first element of the chunk
+/// @param count The number of elements of the chunk
+/// @param data The data given to the parallel for
+typedef void (*func_for_range)(void* elements, uint first, uint count, void* data);
+/// @brief Work of a parallel map on a chunk of an array
+/// @param source The first element of the chunk
+/// @param destination Where the results of the chunk are stored
+/// @param count The number of elements of the chunk
+typedef void (*func_map_range)(const void* source, void* destination, uint count);
+/// @brief Work of a parallel filter on a chunk of an array
+/// @param source The first element of the chunk
+/// @param destination Where the kept elements of the chunk are stored, in order
+/// @param count The number of elements of the chunk
+/// @return The number of kept elements
+typedef uint (*func_filter_range)(const void* source, void* destination, uint count);
+/// @brief Work of a parallel reduction on a chunk of an array
+/// @param source The first element of the chunk
+/// @param count The number of elements of the chunk
+/// @param result Where the reduction of the chunk is stored
+typedef void (*func_reduce_range)(const void* source, uint count, void* result);
+
+/// @brief Run a function on every chunk of an array, on a thread pool
+/// @param array The array
+/// @param elemSize The size of an array element
+/// @param pool The thread pool (NULL for the shared one)
+/// @param grain The number of elements of a chunk (0 for automatic)
+/// @param forRange The work on a chunk
+/// @param data The data given to every call of forRange
+/// @note Consider using "SL_DEFINE_ARRAY_FOR" macro instead
+void __SL_arrayFor_Parallel(array(void)* array, size_t elemSize, thread_pool* pool, uint grain, func_for_range forRange, void* data);
+/// @brief Store a function of every element of an array in another array, on a thread pool
+/// @param source The array
+/// @param destination The array of the results (resized to the count of source, may be source when the sizes match)
+/// @param sourceSize The size of a source element
+/// @param destinationSize The size of a destination element
+/// @param pool The thread pool (NULL for the shared one)
+/// @param grain The number of elements of a chunk (0 for automatic)
+/// @param mapRange The work on a chunk
+/// @note Consider using "SL_DEFINE_ARRAY_MAP" macro instead
+void __SL_arrayMap_Parallel(const array(void)* source, array(void)* destination, size_t sourceSize, size_t destinationSize, thread_pool* pool, uint grain, func_map_range mapRange);
+/// @brief Copy the elements of an array meeting a condition to another array, in order, on a thread pool
+/// @param source The array
+/// @param destination The array of the kept elements (its content is replaced, may be source)
+/// @param elemSize The size of an array element
+/// @param pool The thread pool (NULL for the shared one)
+/// @param grain The number of elements of a chunk (0 for automatic)
+/// @param filterRange The work on a chunk
+/// @note Consider using "SL_DEFINE_ARRAY_FILTER" macro instead
+void __SL_arrayFilter_Parallel(const array(void)* source, array(void)* destination, size_t elemSize, thread_pool* pool, uint grain, func_filter_range filterRange);
+/// @brief Reduce an array to a single element, on a thread pool
+/// @param array The array
+/// @param elemSize The size of an array element
+/// @param pool The thread pool (NULL for the shared one)
+/// @param grain The number of elements of a chunk (0 for automatic)
+/// @param reduceRange The work on a chunk (also used to reduce the results of the chunks)
+/// @param result Where the result is stored
+/// @note Consider using "SL_DEFINE_ARRAY_REDUCE" macro instead
+void __SL_arrayReduce_Parallel(const array(void)* array, size_t elemSize, thread_pool* pool, uint grain, func_reduce_range reduceRange, void* result);
+
+/// @brief Define a parallel for over a type of array
+/// @param name The name of the parallel for
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param data_type The type of the data shared by every element (use void when there is none)
+/// @param varElement The name given to the pointer to the current element
+/// @param varIndex The name given to the index of the current element
+/// @param varData The name given to the pointer to the shared data
+/// @param ... The code run for every element (can only use varElement, varIndex, varData and globals)
+/// @note Defines "static void name(array_type* array, data_type* data, thread_pool* pool, uint grain)", which takes NULL for the shared thread pool and 0 for an automatic grain
+#define SL_DEFINE_ARRAY_FOR(name, array_type, data_type, varElement, varIndex, varData, ...) \
+    typedef typeof(((array_type){0}).data[0]) name##__elem; \
+    static void name##__Range(void* __SL_PARALLEL_ELEMENTS__, uint __SL_PARALLEL_FIRST__, uint __SL_PARALLEL_COUNT__, void* __SL_PARALLEL_DATA__) { \
+        data_type* const varData = __SL_PARALLEL_DATA__; \
+        for (uint __SL_PARALLEL_I__ = 0; __SL_PARALLEL_I__ < __SL_PARALLEL_COUNT__; __SL_PARALLEL_I__++) { \
+            name##__elem* const varElement = (name##__elem*)__SL_PARALLEL_ELEMENTS__ + __SL_PARALLEL_I__; \
+            const uint varIndex = __SL_PARALLEL_FIRST__ + __SL_PARALLEL_I__; \
+            (void)varData; (void)varIndex; \
+            __VA_ARGS__ \
+        } \
+    } \
+    static void name(array_type* array, data_type* data, thread_pool* pool, uint grain) { __SL_arrayFor_Parallel((void*)array, sizeof(name##__elem), pool, grain, name##__Range, (void*)data); }
+/// @brief Define a parallel map from a type of array to another
+/// @param name The name of the parallel map
+/// @param source_type The type of the source array (Use "array(type)" with the type of the element to store)
+/// @param destination_type The type of the destination array
+/// @param varElement The name given to the current source element
+/// @param ... The expression giving the destination element (can only use varElement and globals)
+/// @note Defines "static void name(const source_type* source, destination_type* destination, thread_pool* pool, uint grain)", which takes NULL for the shared thread pool and 0 for an automatic grain
+/// @note The destination is resized to the count of the source, and may be the source when both types are the same
+#define SL_DEFINE_ARRAY_MAP(name, source_type, destination_type, varElement, ...) \
+    typedef typeof(((source_type){0}).data[0]) name##__src; \
+    typedef typeof(((destination_type){0}).data[0]) name##__dst; \
+    static void name##__Range(const void* __SL_PARALLEL_SOURCE__, void* __SL_PARALLEL_DESTINATION__, uint __SL_PARALLEL_COUNT__) { \
+        for (uint __SL_PARALLEL_I__ = 0; __SL_PARALLEL_I__ < __SL_PARALLEL_COUNT__; __SL_PARALLEL_I__++) { \
+            const name##__src varElement = ((const name##__src*)__SL_PARALLEL_SOURCE__)[__SL_PARALLEL_I__]; \
+            ((name##__dst*)__SL_PARALLEL_DESTINATION__)[__SL_PARALLEL_I__] = (__VA_ARGS__); \
+        } \
+    } \
+    static void name(const source_type* source, destination_type* destination, thread_pool* pool, uint grain) { __SL_arrayMap_Parallel((const void*)source, (void*)destination, sizeof(name##__src), sizeof(name##__dst), pool, grain, name##__Range); }
+/// @brief Define a parallel stable filter over a type of array
+/// @param name The name of the parallel filter
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param varElement The name given to the current element
+/// @param ... The condition, true for the elements to keep (can only use varElement and globals)
+/// @note Defines "static void name(const array_type* source, array_type* destination, thread_pool* pool, uint grain)", which takes NULL for the shared thread pool and 0 for an automatic grain
+/// @note The kept elements stay in the same order. The destination may be the source, to filter in place
+/// @note Every chunk compacts its kept elements into a scratch copy of the array, then moves them after those of the previous chunks (prefix sum of their counts)
+#define SL_DEFINE_ARRAY_FILTER(name, array_type, varElement, ...) \
+    typedef typeof(((array_type){0}).data[0]) name##__elem; \
+    static uint name##__Range(const void* __SL_PARALLEL_SOURCE__, void* __SL_PARALLEL_DESTINATION__, uint __SL_PARALLEL_COUNT__) { \
+        uint __SL_PARALLEL_KEPT__ = 0; \
+        for (uint __SL_PARALLEL_I__ = 0; __SL_PARALLEL_I__ < __SL_PARALLEL_COUNT__; __SL_PARALLEL_I__++) { \
+            const name##__elem varElement = ((const name##__elem*)__SL_PARALLEL_SOURCE__)[__SL_PARALLEL_I__]; \
+            if (__VA_ARGS__) ((name##__elem*)__SL_PARALLEL_DESTINATION__)[__SL_PARALLEL_KEPT__++] = varElement; \
+        } \
+        return __SL_PARALLEL_KEPT__; \
+    } \
+    static void name(const array_type* source, array_type* destination, thread_pool* pool, uint grain) { __SL_arrayFilter_Parallel((const void*)source, (void*)destination, sizeof(name##__elem), pool, grain, name##__Range); }
+/// @brief Define a parallel reduction over a type of array
+/// @param name The name of the parallel reduction
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param identity The result of the reduction of no element (0 for a sum, the largest value for a minimum...)
+/// @param varA The name given to the first element combined
+/// @param varB The name given to the second element combined
+/// @param ... The combination of varA and varB (can only use varA, varB and globals), which must be associative
+/// @note Defines "static element name(const array_type* array, thread_pool* pool, uint grain)", which takes NULL for the shared thread pool and 0 for an automatic grain
+/// @note The chunks are combined in order: the result only depends on the count and the grain, never on the thread pool (floating point sums may still differ from a sequential loop)
+#define SL_DEFINE_ARRAY_REDUCE(name, array_type, identity, varA, varB, ...) \
+    typedef typeof(((array_type){0}).data[0]) name##__elem; \
+    static void name##__Range(const void* __SL_PARALLEL_SOURCE__, uint __SL_PARALLEL_COUNT__, void* __SL_PARALLEL_RESULT__) { \
+        name##__elem varA = (identity); \
+        for (uint __SL_PARALLEL_I__ = 0; __SL_PARALLEL_I__ < __SL_PARALLEL_COUNT__; __SL_PARALLEL_I__++) { \
+            const name##__elem varB = ((const name##__elem*)__SL_PARALLEL_SOURCE__)[__SL_PARALLEL_I__]; \
+            varA = (__VA_ARGS__); \
+        } \
+        *(name##__elem*)__SL_PARALLEL_RESULT__ = varA; \
+    } \
+    static name##__elem name(const array_type* array, thread_pool* pool, uint grain) { name##__elem result; __SL_arrayReduce_Parallel((const void*)array, sizeof(name##__elem), pool, grain, name##__Range, &result); return result; }
+
+#define __SL_array_foreach(varname, array_) for (typeof((array_).data[0]) *varname = (array_).data, *varname##Max = (void*)(((size_t)(array_).data) + (array_).count * __elemSize(array_)); (size_t)varname < (size_t)varname##Max; ++varname)
+/// @brief Iterate over every element in array
+/// @param VARNAME_in_ARRAY Should litteraly the name of the variable used to iterate followed by "in" then the name of the array
+/// @note Use like a while-loop or a for-loop (as it is one)
+#define array_foreach(VARNAME_in_ARRAY) __SL_array_foreach(VARNAME_in_ARRAY)
+
 #endif
\ No newline at end of file
@@ -0,0 +1,188 @@
+#include "bitset.h"
+
+#include <stdlib.h>
+#include <memory.h>
+#include "inout.h"
+
+// Words per block of the rank directory
+#define BITSET_RANK_WORDS 8
+
+bitset createBitset(uint count) {
+    bitset new = {.words = calloc((count + 63) / 64 ? (count + 63) / 64 : 1, sizeof(uint64)), .count = count, .ranks = NULL};
+    if (!new.words) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate bitset!");
+    return new;
+}
+void destroyBitset(bitset toDestroy) {
+    free(toDestroy.words);
+    free(toDestroy.ranks);
+}
+bitset* newBitset(uint count) {
+    bitset* new = malloc(sizeof(bitset));
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate bitset!");
+    *new = createBitset(count);
+    return new;
+}
+void freeBitset(bitset* toFree) {
+    destroyBitset(*toFree);
+    free(toFree);
+}
+
+// Unset the bits past the count in the last word
+static inline void bitsetTrim(bitset* b) {
+    if (b->count % 64) b->words[b->count / 64] &= ((uint64)1 << (b->count % 64)) - 1;
+}
+
+void bitsetFill(bitset* b, bool value) {
+    memset(b->words, value ? 0xff : 0, bitsetWordCount(b) * sizeof(uint64));
+    bitsetTrim(b);
+}
+
+// Plain word loops, vectorized by the compiler (a and b may be the same bitset: each word is read before it is written)
+#define BITSET_BINARY_OP(a, b, operation) do { \
+    uint64* x = (a)->words; \
+    const uint64* y = (b)->words; \
+    const uint n = bitsetWordCount(a) < bitsetWordCount(b) ? bitsetWordCount(a) : bitsetWordCount(b); \
+    for (uint i = 0; i < n; i++) x[i] = operation; \
+} while (0)
+
+void bitsetAnd(bitset* a, const bitset* b)    { BITSET_BINARY_OP(a, b, x[i] & y[i]); }
+void bitsetOr(bitset* a, const bitset* b)     { BITSET_BINARY_OP(a, b, x[i] | y[i]); bitsetTrim(a); }
+void bitsetXor(bitset* a, const bitset* b)    { BITSET_BINARY_OP(a, b, x[i] ^ y[i]); bitsetTrim(a); }
+void bitsetAndNot(bitset* a, const bitset* b) { BITSET_BINARY_OP(a, b, x[i] & ~y[i]); }
+void bitsetNot(bitset* b) {
+    uint64* x = b->words;
+    const uint n = bitsetWordCount(b);
+    for (uint i = 0; i < n; i++) x[i] = ~x[i];
+    bitsetTrim(b);
+}
+
+// Set bits of a word: the popcnt instruction when available, otherwise the classic bit twiddling
+static inline uint bitsetPopCount(uint64 x) {
+#ifdef __POPCNT__
+    return __builtin_popcountll(x);
+#else
+    x -= (x >> 1) & 0x5555555555555555ull;
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (uint)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+// Set bits of words
+static uint bitsetPopCountWords(const uint64* words, uint count) {
+    uint64 total = 0;
+#ifdef __POPCNT__
+    for (uint i = 0; i < count; i++) total += __builtin_popcountll(words[i]);
+#else
+    // Per byte counts are summed over up to 31 words before overflowing a byte (31 * 8 = 248), then added up once
+    for (uint i = 0; i < count;) {
+        const uint end = count - i < 31 ? count : i + 31;
+        uint64 bytes = 0;
+        for (; i < end; i++) {
+            uint64 x = words[i];
+            x -= (x >> 1) & 0x5555555555555555ull;
+            x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+            bytes += (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        }
+        const uint64 lanes = (bytes & 0x00ff00ff00ff00ffull) + ((bytes >> 8) & 0x00ff00ff00ff00ffull);
+        total += (lanes * 0x0001000100010001ull) >> 48;
+    }
+#endif
+    return (uint)total;
+}
+
+uint bitsetCount(const bitset* b) {
+    return bitsetPopCountWords(b->words, bitsetWordCount(b));
+}
+
+uint bitsetFindFirst(const bitset* b) {
+    return bitsetFindNext(b, 0);
+}
+uint bitsetFindNext(const bitset* b, uint from) {
+    if (from >= b->count) return b->count;
+    const uint n = bitsetWordCount(b);
+    uint i = from / 64;
+    uint64 w = b->words[i] & (~(uint64)0 << (from % 64));
+    while (!w) {
+        if (++i == n) return b->count;
+        w = b->words[i];
+    }
+    return i * 64 + __builtin_ctzll(w);
+}
+
+void bitsetBuildRank(bitset* b) {
+    const uint n = bitsetWordCount(b);
+    const uint blocks = n / BITSET_RANK_WORDS + 1;
+    uint32* ranks = realloc(b->ranks, blocks * sizeof(uint32));
+    if (!ranks) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate bitset rank directory!");
+    b->ranks = ranks;
+
+    uint32 sum = 0;
+    for (uint k = 0; k < blocks; k++) {
+        ranks[k] = sum;
+        const uint begin = k * BITSET_RANK_WORDS;
+        if (begin < n) sum += bitsetPopCountWords(b->words + begin, n - begin < BITSET_RANK_WORDS ? n - begin : BITSET_RANK_WORDS);
+    }
+}
+
+uint bitsetRank(const bitset* b, uint index) {
+    if (index > b->count) index = b->count;
+    const uint word = index / 64;
+    uint rank;
+    if (b->ranks) {
+        const uint block = word / BITSET_RANK_WORDS;
+        rank = b->ranks[block];
+        for (uint i = block * BITSET_RANK_WORDS; i < word; i++) rank += bitsetPopCount(b->words[i]);
+    }
+    else rank = bitsetPopCountWords(b->words, word);
+    if (index % 64) rank += bitsetPopCount(b->words[word] & (((uint64)1 << (index % 64)) - 1));
+    return rank;
+}
+
+uint bitsetSelect(const bitset* b, uint rank) {
+    const uint n = bitsetWordCount(b);
+    uint i = 0;
+    if (b->ranks) {
+        // Last block starting with at most rank set bits before it
+        uint lo = 0, hi = n / BITSET_RANK_WORDS;
+        while (lo < hi) {
+            const uint mid = (lo + hi + 1) / 2;
+            if (b->ranks[mid] <= rank) lo = mid;
+            else hi = mid - 1;
+        }
+        i = lo * BITSET_RANK_WORDS;
+        rank -= b->ranks[lo];
+    }
+    for (; i < n; i++) {
+        const uint c = bitsetPopCount(b->words[i]);
+        if (rank < c) {
+            // Skip whole bytes, then unset the lowest set bits of the right one
+            uint64 w = b->words[i];
+            uint shift = 0;
+            for (uint byteCount; rank >= (byteCount = bitsetPopCount(w & 0xff)); w >>= 8, shift += 8) rank -= byteCount;
+            for (; rank; rank--) w &= w - 1;
+            return i * 64 + shift + __builtin_ctzll(w);
+        }
+        rank -= c;
+    }
+    return b->count;
+}
+
+bitset createBitsetFromArray(const array(bool)* flags) {
+    bitset new = createBitset(flags->count);
+    const uint full = flags->count / 64;
+    for (uint i = 0; i < full; i++) {
+        const bool* f = flags->data + (size_t)i * 64;
+        uint64 w = 0;
+        for (uint j = 0; j < 64; j++) w |= (uint64)f[j] << j;
+        new.words[i] = w;
+    }
+    for (uint j = full * 64; j < flags->count; j++) if (flags->data[j]) bitsetSet(&new, j);
+    return new;
+}
+array(bool) bitsetToArray(const bitset* b) {
+    array(bool) new = createArray(array(bool), b->count);
+    if (b->count && !new.data) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate array!");
+    for (uint i = 0; i < b->count; i++) new.data[i] = b->words[i / 64] >> (i % 64) & 1;
+    new.count = b->count;
+    return new;
+}
\ No newline at end of file
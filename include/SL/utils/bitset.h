@@ -0,0 +1,134 @@
+#ifndef __SL_UTILS_BITSET_H__
+#define __SL_UTILS_BITSET_H__
+
+#include "../structures.h"
+#include "iter_def.h"
+
+// Flags packed 64 per word: 8 times less memory and bandwidth than array(bool).
+// The bits past the count in the last word are always 0.
+
+/// @brief Packed set of bits
+typedef struct Bitset {
+    uint64* words;
+    uint count;     // Number of bits
+    uint32* ranks;  // Number of set bits before each block of 512 bits (NULL until "bitsetBuildRank" is called)
+} bitset;
+
+/// @brief Create a bitset ON STACK
+/// @param count The number of bits (all unset)
+/// @return The newly created bitset
+bitset createBitset(uint count);
+/// @brief Destroy a bitset
+/// @param toDestroy The bitset to destroy
+void destroyBitset(bitset toDestroy);
+/// @brief Create a new bitset ON HEAP
+/// @param count The number of bits (all unset)
+/// @return The newly created bitset
+bitset* newBitset(uint count);
+/// @brief Free a bitset
+/// @param toFree The bitset to free
+void freeBitset(bitset* toFree);
+
+/// @brief Get the number of words of a bitset
+/// @param b The bitset
+/// @return The number of uint64 holding its bits
+static inline uint bitsetWordCount(const bitset* b) { return (b->count + 63) / 64; }
+
+/// @brief Get a bit of a bitset
+/// @param b The bitset
+/// @param index The index of the bit
+/// @return Whether the bit is set
+static inline bool bitsetGet(const bitset* b, uint index) { return b->words[index / 64] >> (index % 64) & 1; }
+/// @brief Set a bit of a bitset
+/// @param b The bitset
+/// @param index The index of the bit
+static inline void bitsetSet(bitset* b, uint index)       { b->words[index / 64] |= (uint64)1 << (index % 64); }
+/// @brief Unset a bit of a bitset
+/// @param b The bitset
+/// @param index The index of the bit
+static inline void bitsetReset(bitset* b, uint index)     { b->words[index / 64] &= ~((uint64)1 << (index % 64)); }
+/// @brief Flip a bit of a bitset
+/// @param b The bitset
+/// @param index The index of the bit
+static inline void bitsetToggle(bitset* b, uint index)    { b->words[index / 64] ^= (uint64)1 << (index % 64); }
+/// @brief Give a value to a bit of a bitset
+/// @param b The bitset
+/// @param index The index of the bit
+/// @param value The value of the bit
+static inline void bitsetAssign(bitset* b, uint index, bool value) {
+    uint64* w = b->words + index / 64;
+    *w = (*w & ~((uint64)1 << (index % 64))) | (uint64)value << (index % 64);
+}
+
+/// @brief Give the same value to every bit of a bitset
+/// @param b The bitset
+/// @param value The value of the bits
+void bitsetFill(bitset* b, bool value);
+/// @brief Keep the bits of a bitset set in another one too (a &= b)
+/// @param a The bitset to modify
+/// @param b The other bitset (same count)
+void bitsetAnd(bitset* a, const bitset* b);
+/// @brief Set the bits of a bitset set in another one (a |= b)
+/// @param a The bitset to modify
+/// @param b The other bitset (same count)
+void bitsetOr(bitset* a, const bitset* b);
+/// @brief Flip the bits of a bitset set in another one (a ^= b)
+/// @param a The bitset to modify
+/// @param b The other bitset (same count)
+void bitsetXor(bitset* a, const bitset* b);
+/// @brief Unset the bits of a bitset set in another one (a &= ~b)
+/// @param a The bitset to modify
+/// @param b The other bitset (same count)
+void bitsetAndNot(bitset* a, const bitset* b);
+/// @brief Flip every bit of a bitset
+/// @param b The bitset to modify
+void bitsetNot(bitset* b);
+
+/// @brief Count the set bits of a bitset
+/// @param b The bitset
+/// @return The number of set bits
+uint bitsetCount(const bitset* b);
+/// @brief Find the first set bit of a bitset
+/// @param b The bitset
+/// @return The index of the bit, or the count of the bitset if none is set
+uint bitsetFindFirst(const bitset* b);
+/// @brief Find the next set bit of a bitset
+/// @param b The bitset
+/// @param from The index to start from (included)
+/// @return The index of the first set bit at or after from, or the count of the bitset if there is none
+uint bitsetFindNext(const bitset* b, uint from);
+
+/// @brief Build the rank directory of a bitset, making "bitsetRank" O(1) and "bitsetSelect" O(log(n))
+/// @param b The bitset
+/// @note Call again after modifying the bitset: the directory is not updated
+/// @note Takes 1 bit of memory for every 16 bits of the bitset
+void bitsetBuildRank(bitset* b);
+/// @brief Count the set bits of a bitset before an index
+/// @param b The bitset
+/// @param index The index (excluded)
+/// @return The number of set bits in [0, index[
+/// @note Scans the words before index if the rank directory is not built
+uint bitsetRank(const bitset* b, uint index);
+/// @brief Find a set bit of a bitset by its rank
+/// @param b The bitset
+/// @param rank The number of set bits before the one to find
+/// @return The index of the bit, or the count of the bitset if it has no more than rank set bits
+/// @note Scans the words if the rank directory is not built
+uint bitsetSelect(const bitset* b, uint rank);
+
+/// @brief Create a bitset from an array of bools ON STACK
+/// @param flags The array
+/// @return The newly created bitset
+bitset createBitsetFromArray(const array(bool)* flags);
+/// @brief Create an array of bools from a bitset ON STACK
+/// @param b The bitset
+/// @return The newly created array
+array(bool) bitsetToArray(const bitset* b);
+
+#define __SL_bitset_foreach(varname, bitset_) for (uint varname = bitsetFindFirst(&(bitset_)); varname < (bitset_).count; varname = bitsetFindNext(&(bitset_), varname + 1))
+/// @brief Iterate over the indices of the set bits of a bitset
+/// @param VARNAME_in_BITSET Should litteraly the name of the variable used to iterate followed by "in" then the name of the bitset
+/// @note Use like a while-loop or a for-loop (as it is one)
+#define bitset_foreach(VARNAME_in_BITSET) __SL_bitset_foreach(VARNAME_in_BITSET)
+
+#endif
\ No newline at end of file
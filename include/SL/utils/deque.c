@@ -0,0 +1,65 @@
+#include "deque.h"
+
+#include <stdlib.h>
+#include <memory.h>
+#include "inout.h"
+
+// Smallest capacity of a growing deque, in elements
+#define DEQUE_MIN_CAPACITY 8
+
+deque(void)* __SL_newDeque(size_t elemSize, uint initialCapacity) {
+    deque(void)* new = malloc(sizeof(deque(void)));
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate deque!");
+    new->capa = __SL_dequeCapacity(initialCapacity);
+    new->data = malloc(new->capa * elemSize);
+    new->count = 0;
+    new->head = 0;
+    return new;
+}
+
+// Grow to a power of two capacity of at least count elements
+static void dequeReserve(deque(void)* d, uint count, size_t elemSize) {
+    if (count <= d->capa) return;
+    uint newCapa = d->capa ? d->capa : DEQUE_MIN_CAPACITY;
+    while (newCapa < count) newCapa *= 2;
+
+    uint8* data = realloc(d->data, (size_t)newCapa * elemSize);
+    if (!data) SL_throwError("INSUFFICIENT MEMORY - Failed to resize deque to %u elements!", newCapa);
+
+    // The elements that wrapped around the old end must follow the others: move the shorter part
+    const uint front = d->capa - d->head; // Elements from head to the old end
+    if (d->count > front) {
+        const uint wrapped = d->count - front;
+        if (wrapped <= front) memcpy(data + (size_t)d->capa * elemSize, data, (size_t)wrapped * elemSize);
+        else {
+            const uint newHead = newCapa - front;
+            memmove(data + (size_t)newHead * elemSize, data + (size_t)d->head * elemSize, (size_t)front * elemSize);
+            d->head = newHead;
+        }
+    }
+    d->data = data;
+    d->capa = newCapa;
+}
+
+void __SL_dequeGrow(deque(void)* d, size_t elemSize) {
+    dequeReserve(d, d->capa ? d->capa * 2 : DEQUE_MIN_CAPACITY, elemSize);
+}
+
+void __SL_dequePushBackMultiple(deque(void)* d, const void* data, uint dataCount, size_t elemSize) {
+    dequeReserve(d, d->count + dataCount, elemSize);
+    const uint tail = (d->head + d->count) & (d->capa - 1);
+    const uint first = dataCount < d->capa - tail ? dataCount : d->capa - tail;
+    memcpy((uint8*)d->data + (size_t)tail * elemSize, data, (size_t)first * elemSize);
+    memcpy(d->data, (const uint8*)data + (size_t)first * elemSize, (size_t)(dataCount - first) * elemSize);
+    d->count += dataCount;
+}
+
+uint __SL_dequePopFrontMultiple(deque(void)* d, void* destination, uint count, size_t elemSize) {
+    if (count > d->count) count = d->count;
+    const uint first = count < d->capa - d->head ? count : d->capa - d->head;
+    memcpy(destination, (uint8*)d->data + (size_t)d->head * elemSize, (size_t)first * elemSize);
+    memcpy((uint8*)destination + (size_t)first * elemSize, d->data, (size_t)(count - first) * elemSize);
+    d->count -= count;
+    d->head = d->capa ? (d->head + count) & (d->capa - 1) : 0;
+    return count;
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef __SL_UTILS_DEQUE_H__
+#define __SL_UTILS_DEQUE_H__
+
+#include "../structures.h"
+
+// Ring buffer: element i is at (head + i) & (capa - 1), so pushing and popping at both ends is O(1).
+// Grows like array(T) (realloc, doubling), moving only the shorter of the two wrapped parts.
+
+#define __SL_DEFINE_DEQUE_0P(type, type_with_p_instead_of_stars_dq) typedef struct type_with_p_instead_of_stars_dq   { type* data;    uint count; uint head; uint capa; } type_with_p_instead_of_stars_dq
+#define __SL_DEFINE_DEQUE_1P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_dq { type** data;   uint count; uint head; uint capa; } type_with_p_instead_of_stars##_dq
+#define __SL_DEFINE_DEQUE_2P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_dq { type*** data;  uint count; uint head; uint capa; } type_with_p_instead_of_stars##_dq
+#define __SL_DEFINE_DEQUE_3P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_dq { type**** data; uint count; uint head; uint capa; } type_with_p_instead_of_stars##_dq
+#define SL_DEFINE_DEQUE(type) \
+    __SL_DEFINE_DEQUE_0P (type, type##_dq ); \
+    __SL_DEFINE_DEQUE_1P (type, type##p   ); \
+    __SL_DEFINE_DEQUE_2P (type, type##pp  ); \
+    __SL_DEFINE_DEQUE_3P (type, type##ppp )
+
+#define deque(type, ...) type##__VA_ARGS__##_dq
+
+SL_DEFINE_DEQUE(void);
+
+/// @brief Get the capacity of a deque able to hold a number of elements
+/// @param count The number of elements
+/// @return The closest power of two above count (0 for 0)
+static ALWAYS_INLINE uint __SL_dequeCapacity(uint count) { return count <= 1 ? count : 1u << (32 - __builtin_clz(count - 1)); }
+
+/// @brief Create a deque ON STACK
+/// @param deque_type The type of the deque (Use "deque(type)" with the type of the element to store)
+/// @param initialCapacity The initial capacity of the deque (will use closest power of two above)
+/// @return The newly created deque
+#define createDeque(deque_type, initialCapacity) ((deque_type){.data = malloc(__SL_dequeCapacity(initialCapacity) * sizeof(((deque_type){0}).data[0])), .count = 0, .head = 0, .capa = __SL_dequeCapacity(initialCapacity)})
+/// @brief Destroy a deque
+/// @param deque_ The deque to destroy
+#define destroyDeque(deque_) (free((deque_).data))
+/// @brief Create a new deque ON HEAP
+/// @param deque_type The type of the deque (Use "deque(type)" with the type of the element to store)
+/// @param initialCapacity The initial capacity of the deque (will use closest power of two above)
+/// @return The newly created deque
+#define newDeque(deque_type, initialCapacity) ((deque_type*)__SL_newDeque(sizeof(((deque_type){0}).data[0]), initialCapacity))
+/// @brief Create a new deque ON HEAP
+/// @param elemSize The size of a deque element
+/// @param initialCapacity The initial capacity of the deque (will use closest power of two above)
+/// @return The newly created deque
+/// @note Consider using "newDeque" macro instead
+deque(void)* __SL_newDeque(size_t elemSize, uint initialCapacity);
+/// @brief Free a deque
+/// @param deque_ The deque to free
+#define freeDeque(deque_) do { free((deque_)->data); free(deque_); } while (0)
+
+/// @brief Double the capacity of a deque
+/// @param deque The deque
+/// @param elemSize The size of a deque element
+/// @note Every macro provided by the SL already calls this function when adding elements
+void __SL_dequeGrow(deque(void)* deque, size_t elemSize);
+/// @brief Add a C-array to the back of a deque
+/// @param deque The deque
+/// @param data The C-array to add
+/// @param dataCount The size of the C-array
+/// @param elemSize The size of a deque element
+/// @note Consider using "dequePushBack_T" macro instead
+void __SL_dequePushBackMultiple(deque(void)* deque, const void* data, uint dataCount, size_t elemSize);
+/// @brief Remove elements from the front of a deque into a C-array
+/// @param deque The deque
+/// @param destination Where the elements are copied
+/// @param count The maximum number of elements to remove
+/// @param elemSize The size of a deque element
+/// @return The number of elements removed
+/// @note Consider using "dequePopFront_T" macro instead
+uint __SL_dequePopFrontMultiple(deque(void)* deque, void* destination, uint count, size_t elemSize);
+
+/// @brief Access an element of a deque
+/// @param deque_ The deque
+/// @param index The index of the element from the front
+#define dequeAt(deque_, index)  ((deque_).data[((deque_).head + (index)) & ((deque_).capa - 1)])
+/// @brief Access an element of a deque
+/// @param deque_ The deque
+/// @param index The index of the element from the front
+#define dequeAt_(deque_, index) ((deque_)->data[((deque_)->head + (index)) & ((deque_)->capa - 1)])
+/// @brief Get first element of a deque
+/// @param deque_ The deque
+#define dequeFront(deque_)  dequeAt(deque_, 0)
+/// @brief Get first element of a deque
+/// @param deque_ The deque
+#define dequeFront_(deque_) dequeAt_(deque_, 0)
+/// @brief Get last element of a deque
+/// @param deque_ The deque
+#define dequeBack(deque_)  dequeAt(deque_, (deque_).count - 1)
+/// @brief Get last element of a deque
+/// @param deque_ The deque
+#define dequeBack_(deque_) dequeAt_(deque_, (deque_)->count - 1)
+
+/// @brief Add an element to the back of a deque
+/// @param deque_ The deque to modify
+/// @param ... The value to add
+#define dequePushBack(deque_, ...)  do { if ((deque_).count == (deque_).capa)   __SL_dequeGrow((void*)&(deque_), sizeof((deque_).data[0]));  dequeAt(deque_, (deque_).count) = __VA_ARGS__;  (deque_).count++; } while (0)
+/// @brief Add an element to the back of a deque
+/// @param deque_ The deque to modify
+/// @param ... The value to add
+#define dequePushBack_(deque_, ...) do { if ((deque_)->count == (deque_)->capa) __SL_dequeGrow((void*) (deque_), sizeof((deque_)->data[0])); dequeAt_(deque_, (deque_)->count) = __VA_ARGS__; (deque_)->count++; } while (0)
+/// @brief Add an element to the front of a deque
+/// @param deque_ The deque to modify
+/// @param ... The value to add
+#define dequePushFront(deque_, ...)  do { if ((deque_).count == (deque_).capa)   __SL_dequeGrow((void*)&(deque_), sizeof((deque_).data[0]));  (deque_).head = ((deque_).head - 1) & ((deque_).capa - 1);   (deque_).data[(deque_).head] = __VA_ARGS__;  (deque_).count++; } while (0)
+/// @brief Add an element to the front of a deque
+/// @param deque_ The deque to modify
+/// @param ... The value to add
+#define dequePushFront_(deque_, ...) do { if ((deque_)->count == (deque_)->capa) __SL_dequeGrow((void*) (deque_), sizeof((deque_)->data[0])); (deque_)->head = ((deque_)->head - 1) & ((deque_)->capa - 1); (deque_)->data[(deque_)->head] = __VA_ARGS__; (deque_)->count++; } while (0)
+
+/// @brief Pop first element of a deque
+/// @param deque_ The deque
+#define dequePopFront(deque_)  ((deque_).data[((deque_).count--, (deque_).head = ((deque_).head + 1) & ((deque_).capa - 1), ((deque_).head - 1) & ((deque_).capa - 1))])
+/// @brief Pop first element of a deque
+/// @param deque_ The deque
+#define dequePopFront_(deque_) ((deque_)->data[((deque_)->count--, (deque_)->head = ((deque_)->head + 1) & ((deque_)->capa - 1), ((deque_)->head - 1) & ((deque_)->capa - 1))])
+/// @brief Pop last element of a deque
+/// @param deque_ The deque
+#define dequePopBack(deque_)  ((deque_).data[((deque_).head + --(deque_).count) & ((deque_).capa - 1)])
+/// @brief Pop last element of a deque
+/// @param deque_ The deque
+#define dequePopBack_(deque_) ((deque_)->data[((deque_)->head + --(deque_)->count) & ((deque_)->capa - 1)])
+
+/// @brief Add multiple elements to the back of a deque (C-array version)
+/// @param deque_ The deque to modify
+/// @param elements The elements to add
+/// @param count The number of elements to add
+/// @note Copies at most two blocks of memory
+#define dequePushBack_T(deque_, elements, count)  __SL_dequePushBackMultiple((void*)&(deque_), elements, count, sizeof((deque_).data[0]))
+/// @brief Add multiple elements to the back of a deque (C-array version)
+/// @param deque_ The deque to modify
+/// @param elements The elements to add
+/// @param count The number of elements to add
+/// @note Copies at most two blocks of memory
+#define dequePushBack_T_(deque_, elements, count) __SL_dequePushBackMultiple((void*) (deque_), elements, count, sizeof((deque_)->data[0]))
+/// @brief Remove multiple elements from the front of a deque (C-array version)
+/// @param deque_ The deque to modify
+/// @param destination Where the elements are copied
+/// @param count The maximum number of elements to remove
+/// @return The number of elements removed
+/// @note Copies at most two blocks of memory
+#define dequePopFront_T(deque_, destination, count)  __SL_dequePopFrontMultiple((void*)&(deque_), destination, count, sizeof((deque_).data[0]))
+/// @brief Remove multiple elements from the front of a deque (C-array version)
+/// @param deque_ The deque to modify
+/// @param destination Where the elements are copied
+/// @param count The maximum number of elements to remove
+/// @return The number of elements removed
+/// @note Copies at most two blocks of memory
+#define dequePopFront_T_(deque_, destination, count) __SL_dequePopFrontMultiple((void*) (deque_), destination, count, sizeof((deque_)->data[0]))
+
+// A plain pointer loop over each of the (at most two) contiguous parts, stopping at the first "break"
+#define __SL_deque_foreach(varname, deque_) \
+    for (typeof((deque_).data) varname = NULL, varname##Max = NULL, *varname##Once = (void*)1; varname##Once; varname##Once = NULL) \
+    for (uint varname##Begin = (deque_).head, varname##Left = (deque_).count; varname == varname##Max && varname##Left; ) \
+    for (varname = (deque_).data + varname##Begin, \
+         varname##Max = varname + (varname##Left < (deque_).capa - varname##Begin ? varname##Left : (deque_).capa - varname##Begin), \
+         varname##Left -= varname##Max - varname, varname##Begin = 0; varname < varname##Max; ++varname)
+/// @brief Iterate over every element in deque, from front to back
+/// @param VARNAME_in_DEQUE Should litteraly the name of the variable used to iterate followed by "in" then the name of the deque
+/// @note Use like a while-loop or a for-loop (as it is one)
+#define deque_foreach(VARNAME_in_DEQUE) __SL_deque_foreach(VARNAME_in_DEQUE)
+
+#endif
\ No newline at end of file
@@ -1,40 +1,105 @@
-#ifndef __SL_UTILS_ARRAY_DEF_H__
-#define __SL_UTILS_ARRAY_DEF_H__
-
-#include "array.h"
-#include "list.h"
-#include "../structures.h"
-
-SL_DEFINE_ARRAY(bool);
-SL_DEFINE_ARRAY(char);  SL_DEFINE_ARRAY(char8);  SL_DEFINE_ARRAY(char16); SL_DEFINE_ARRAY(char32);
-SL_DEFINE_ARRAY(int);   SL_DEFINE_ARRAY(int8);   SL_DEFINE_ARRAY(int16);  SL_DEFINE_ARRAY(int32);  SL_DEFINE_ARRAY(int64);
-SL_DEFINE_ARRAY(uint);  SL_DEFINE_ARRAY(uint8);  SL_DEFINE_ARRAY(uint16); SL_DEFINE_ARRAY(uint32); SL_DEFINE_ARRAY(uint64);
-SL_DEFINE_ARRAY(float); SL_DEFINE_ARRAY(double);
-
-SL_DEFINE_LIST(bool);
-SL_DEFINE_LIST(char);  SL_DEFINE_LIST(char8);  SL_DEFINE_LIST(char16); SL_DEFINE_LIST(char32);
-SL_DEFINE_LIST(int);   SL_DEFINE_LIST(int8);   SL_DEFINE_LIST(int16);  SL_DEFINE_LIST(int32);  SL_DEFINE_LIST(int64);
-SL_DEFINE_LIST(uint);  SL_DEFINE_LIST(uint8);  SL_DEFINE_LIST(uint16); SL_DEFINE_LIST(uint32); SL_DEFINE_LIST(uint64);
-SL_DEFINE_LIST(float); SL_DEFINE_LIST(double);
-
-#include "../maths/vector.h"
-
-#define __SL_GEN_VectorArrays(prefix) SL_DEFINE_ARRAY(prefix##vec2); SL_DEFINE_ARRAY(prefix##vec3); SL_DEFINE_ARRAY(prefix##vec4)
-#define __SL_GEN_VectorLists(prefix)  SL_DEFINE_LIST (prefix##vec2); SL_DEFINE_LIST (prefix##vec3); SL_DEFINE_LIST (prefix##vec4)
-
-__SL_GEN_VectorArrays(); __SL_GEN_VectorArrays(d); __SL_GEN_VectorArrays(i); __SL_GEN_VectorArrays(u); __SL_GEN_VectorArrays(li); __SL_GEN_VectorArrays(lu); __SL_GEN_VectorArrays(b);
-__SL_GEN_VectorLists();  __SL_GEN_VectorLists(d);  __SL_GEN_VectorLists(i);  __SL_GEN_VectorLists(u);  __SL_GEN_VectorLists(li);  __SL_GEN_VectorLists(lu);  __SL_GEN_VectorLists(b);
-
-#include "../maths/quaternion.h"
-
-SL_DEFINE_ARRAY(quat);
-SL_DEFINE_LIST (quat);
-
-#include "../maths/matrix.h"
-
-SL_DEFINE_ARRAY(mat);
-SL_DEFINE_LIST(mat);
-SL_DEFINE_ARRAY(mat2x2); SL_DEFINE_ARRAY(mat3x3); SL_DEFINE_ARRAY(mat4x4);
-SL_DEFINE_LIST(mat2x2);  SL_DEFINE_LIST(mat3x3);  SL_DEFINE_LIST(mat4x4);
-
+#ifndef __SL_UTILS_ARRAY_DEF_H__
+#define __SL_UTILS_ARRAY_DEF_H__
+
+#include "array.h"
+#include "list.h"
+#include "segArray.h"
+#include "deque.h"
+#include "../structures.h"
+
+SL_DEFINE_ARRAY(bool);
+SL_DEFINE_ARRAY(char);  SL_DEFINE_ARRAY(char8);  SL_DEFINE_ARRAY(char16); SL_DEFINE_ARRAY(char32);
+SL_DEFINE_ARRAY(int);   SL_DEFINE_ARRAY(int8);   SL_DEFINE_ARRAY(int16);  SL_DEFINE_ARRAY(int32);  SL_DEFINE_ARRAY(int64);
+SL_DEFINE_ARRAY(uint);  SL_DEFINE_ARRAY(uint8);  SL_DEFINE_ARRAY(uint16); SL_DEFINE_ARRAY(uint32); SL_DEFINE_ARRAY(uint64);
+SL_DEFINE_ARRAY(float); SL_DEFINE_ARRAY(double);
+
+SL_DEFINE_LIST(bool);
+SL_DEFINE_LIST(char);  SL_DEFINE_LIST(char8);  SL_DEFINE_LIST(char16); SL_DEFINE_LIST(char32);
+SL_DEFINE_LIST(int);   SL_DEFINE_LIST(int8);   SL_DEFINE_LIST(int16);  SL_DEFINE_LIST(int32);  SL_DEFINE_LIST(int64);
+SL_DEFINE_LIST(uint);  SL_DEFINE_LIST(uint8);  SL_DEFINE_LIST(uint16); SL_DEFINE_LIST(uint32); SL_DEFINE_LIST(uint64);
+SL_DEFINE_LIST(float); SL_DEFINE_LIST(double);
+
+SL_DEFINE_SEG_ARRAY(bool);
+SL_DEFINE_SEG_ARRAY(char);  SL_DEFINE_SEG_ARRAY(char8);  SL_DEFINE_SEG_ARRAY(char16); SL_DEFINE_SEG_ARRAY(char32);
+SL_DEFINE_SEG_ARRAY(int);   SL_DEFINE_SEG_ARRAY(int8);   SL_DEFINE_SEG_ARRAY(int16);  SL_DEFINE_SEG_ARRAY(int32);  SL_DEFINE_SEG_ARRAY(int64);
+SL_DEFINE_SEG_ARRAY(uint);  SL_DEFINE_SEG_ARRAY(uint8);  SL_DEFINE_SEG_ARRAY(uint16); SL_DEFINE_SEG_ARRAY(uint32); SL_DEFINE_SEG_ARRAY(uint64);
+SL_DEFINE_SEG_ARRAY(float); SL_DEFINE_SEG_ARRAY(double);
+
+SL_DEFINE_DEQUE(bool);
+SL_DEFINE_DEQUE(char);  SL_DEFINE_DEQUE(char8);  SL_DEFINE_DEQUE(char16); SL_DEFINE_DEQUE(char32);
+SL_DEFINE_DEQUE(int);   SL_DEFINE_DEQUE(int8);   SL_DEFINE_DEQUE(int16);  SL_DEFINE_DEQUE(int32);  SL_DEFINE_DEQUE(int64);
+SL_DEFINE_DEQUE(uint);  SL_DEFINE_DEQUE(uint8);  SL_DEFINE_DEQUE(uint16); SL_DEFINE_DEQUE(uint32); SL_DEFINE_DEQUE(uint64);
+SL_DEFINE_DEQUE(float); SL_DEFINE_DEQUE(double);
+
+#include "../maths/vector.h"
+
+#define __SL_GEN_VectorArrays(prefix) SL_DEFINE_ARRAY(prefix##vec2); SL_DEFINE_ARRAY(prefix##vec3); SL_DEFINE_ARRAY(prefix##vec4)
+#define __SL_GEN_VectorLists(prefix)  SL_DEFINE_LIST (prefix##vec2); SL_DEFINE_LIST (prefix##vec3); SL_DEFINE_LIST (prefix##vec4)
+#define __SL_GEN_VectorSegArrays(prefix) SL_DEFINE_SEG_ARRAY(prefix##vec2); SL_DEFINE_SEG_ARRAY(prefix##vec3); SL_DEFINE_SEG_ARRAY(prefix##vec4)
+#define __SL_GEN_VectorDeques(prefix) SL_DEFINE_DEQUE(prefix##vec2); SL_DEFINE_DEQUE(prefix##vec3); SL_DEFINE_DEQUE(prefix##vec4)
+
+__SL_GEN_VectorArrays(); __SL_GEN_VectorArrays(d); __SL_GEN_VectorArrays(i); __SL_GEN_VectorArrays(u); __SL_GEN_VectorArrays(li); __SL_GEN_VectorArrays(lu); __SL_GEN_VectorArrays(b);
+__SL_GEN_VectorLists();  __SL_GEN_VectorLists(d);  __SL_GEN_VectorLists(i);  __SL_GEN_VectorLists(u);  __SL_GEN_VectorLists(li);  __SL_GEN_VectorLists(lu);  __SL_GEN_VectorLists(b);
+__SL_GEN_VectorSegArrays(); __SL_GEN_VectorSegArrays(d); __SL_GEN_VectorSegArrays(i); __SL_GEN_VectorSegArrays(u); __SL_GEN_VectorSegArrays(li); __SL_GEN_VectorSegArrays(lu); __SL_GEN_VectorSegArrays(b);
+__SL_GEN_VectorDeques(); __SL_GEN_VectorDeques(d); __SL_GEN_VectorDeques(i); __SL_GEN_VectorDeques(u); __SL_GEN_VectorDeques(li); __SL_GEN_VectorDeques(lu); __SL_GEN_VectorDeques(b);
+
+#include "../maths/quaternion.h"
+
+SL_DEFINE_ARRAY(quat);
+SL_DEFINE_LIST (quat);
+
+#include "../maths/matrix.h"
+
+SL_DEFINE_ARRAY(mat);
+SL_DEFINE_LIST(mat);
+SL_DEFINE_ARRAY(mat2x2); SL_DEFINE_ARRAY(mat3x3); SL_DEFINE_ARRAY(mat4x4);
+SL_DEFINE_LIST(mat2x2);  SL_DEFINE_LIST(mat3x3);  SL_DEFINE_LIST(mat4x4);
+
+// Kind of the keys of an element, from a pointer to it
+#define __SL_radixKind(pointer) _Generic((pointer), \
+    bool*: RADIX_KEY_UNSIGNED, char*: ((char)-1 < 0 ? RADIX_KEY_SIGNED : RADIX_KEY_UNSIGNED), \
+    signed char*: RADIX_KEY_SIGNED,   short*: RADIX_KEY_SIGNED,            int*: RADIX_KEY_SIGNED,            long*: RADIX_KEY_SIGNED,            long long*: RADIX_KEY_SIGNED, \
+    unsigned char*: RADIX_KEY_UNSIGNED, unsigned short*: RADIX_KEY_UNSIGNED, unsigned int*: RADIX_KEY_UNSIGNED, unsigned long*: RADIX_KEY_UNSIGNED, unsigned long long*: RADIX_KEY_UNSIGNED, \
+    float*: RADIX_KEY_FLOAT, double*: RADIX_KEY_FLOAT, \
+    vec2*:  RADIX_KEY_FLOAT,    vec3*:  RADIX_KEY_FLOAT,    vec4*:  RADIX_KEY_FLOAT, \
+    dvec2*: RADIX_KEY_FLOAT,    dvec3*: RADIX_KEY_FLOAT,    dvec4*: RADIX_KEY_FLOAT, \
+    ivec2*: RADIX_KEY_SIGNED,   ivec3*: RADIX_KEY_SIGNED,   ivec4*: RADIX_KEY_SIGNED, \
+    livec2*: RADIX_KEY_SIGNED,  livec3*: RADIX_KEY_SIGNED,  livec4*: RADIX_KEY_SIGNED, \
+    uvec2*: RADIX_KEY_UNSIGNED, uvec3*: RADIX_KEY_UNSIGNED, uvec4*: RADIX_KEY_UNSIGNED, \
+    luvec2*: RADIX_KEY_UNSIGNED, luvec3*: RADIX_KEY_UNSIGNED, luvec4*: RADIX_KEY_UNSIGNED, \
+    bvec2*: RADIX_KEY_UNSIGNED, bvec3*: RADIX_KEY_UNSIGNED, bvec4*: RADIX_KEY_UNSIGNED)
+// Size of the keys of an element (its components for vectors), from a pointer to it
+#define __SL_radixKeySize(pointer) _Generic((pointer), \
+    vec2*: sizeof(float),   vec3*: sizeof(float),   vec4*: sizeof(float), \
+    dvec2*: sizeof(double), dvec3*: sizeof(double), dvec4*: sizeof(double), \
+    ivec2*: sizeof(int),    ivec3*: sizeof(int),    ivec4*: sizeof(int), \
+    livec2*: sizeof(int64), livec3*: sizeof(int64), livec4*: sizeof(int64), \
+    uvec2*: sizeof(uint),   uvec3*: sizeof(uint),   uvec4*: sizeof(uint), \
+    luvec2*: sizeof(uint64), luvec3*: sizeof(uint64), luvec4*: sizeof(uint64), \
+    bvec2*: sizeof(bool),   bvec3*: sizeof(bool),   bvec4*: sizeof(bool), \
+    default: sizeof(*(pointer)))
+
+/// @brief Sort an array of integers, floats or vectors in increasing order by radix sort
+/// @param array_ The array to sort
+/// @note Stable and in O(n) (one pass per byte of the element, skipping the bytes shared by all elements), but allocates a copy of the array
+/// @note Vectors are sorted by x, then y, then z, then w
+/// @note Floats follow their total order: -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN
+#define arrayRadixSort(array_)  __SL_arrayRadixSort((void*)&(array_), __elemSize(array_),  __SL_radixKeySize((array_).data),  __SL_radixKind((array_).data))
+/// @brief Sort an array of integers, floats or vectors in increasing order by radix sort
+/// @param array_ The array to sort
+/// @note Stable and in O(n) (one pass per byte of the element, skipping the bytes shared by all elements), but allocates a copy of the array
+/// @note Vectors are sorted by x, then y, then z, then w
+/// @note Floats follow their total order: -NaN < -inf < ... < -0 < +0 < ... < +inf < +NaN
+#define arrayRadixSort_(array_) __SL_arrayRadixSort((void*) (array_),  __elemSize(*array_), __SL_radixKeySize((array_)->data), __SL_radixKind((array_)->data))
+/// @brief Sort an array of integers, floats or vectors in increasing order by radix sort, on a thread pool
+/// @param array_ The array to sort
+/// @param pool The thread pool (NULL for the shared one)
+/// @note Same order as "arrayRadixSort": each pass counts and moves the elements of one part of the array per thread
+#define arrayRadixSort_Parallel(array_, pool)  __SL_arrayRadixSort_Parallel((void*)&(array_), __elemSize(array_),  __SL_radixKeySize((array_).data),  __SL_radixKind((array_).data), pool)
+/// @brief Sort an array of integers, floats or vectors in increasing order by radix sort, on a thread pool
+/// @param array_ The array to sort
+/// @param pool The thread pool (NULL for the shared one)
+/// @note Same order as "arrayRadixSort": each pass counts and moves the elements of one part of the array per thread
+#define arrayRadixSort_Parallel_(array_, pool) __SL_arrayRadixSort_Parallel((void*) (array_),  __elemSize(*array_), __SL_radixKeySize((array_)->data), __SL_radixKind((array_)->data), pool)
+
 #endif
\ No newline at end of file
@@ -0,0 +1,224 @@
+#ifndef _WIN32
+#define _GNU_SOURCE // mremap
+#endif
+// The system headers come first, as some of them declare a "uint" type
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "mappedArray.h"
+#include "inout.h"
+
+#define MAPPED_ARRAY_MAGIC "SLARRAY1"
+// Bits of the alignment of a mapped array holding the slot of its control block
+#define MAPPED_ARRAY_SLOT_MASK (ARRAY_MAPPED_STORAGE - 1)
+
+// The start of the file, shared by every array mapping it
+typedef struct MappedArrayHeader {
+    char magic[8];
+    uint64 elemSize;
+    uint64 count;
+    uint64 capacity;    // Bytes of storage following the header
+    uint64 reserved[4];
+} mapped_array_header;
+_Static_assert(sizeof(mapped_array_header) == MAPPED_ARRAY_HEADER_SIZE, "The header of a mapped array must fill MAPPED_ARRAY_HEADER_SIZE bytes");
+
+// What a process knows of one of its mapped arrays, never written to the file
+typedef struct MappedArrayControl {
+    mapped_array_header* header;
+    size_t size;        // Bytes mapped, header included
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#else
+    int file;
+#endif
+    bool readOnly;
+} mapped_array_control;
+
+// Control blocks of the open mapped arrays, found from the slot kept in the alignment of the array
+static mapped_array_control** controls = NULL;
+static uint controlCount = 0;
+static pthread_mutex_t controlsLock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint mappedArrayAddControl(mapped_array_control* control) {
+    pthread_mutex_lock(&controlsLock);
+    uint slot = 0;
+    while (slot < controlCount && controls[slot]) slot++;
+    if (slot == controlCount) {
+        if (controlCount == MAPPED_ARRAY_SLOT_MASK) SL_throwError("INSUFFICIENT MEMORY - Too many mapped arrays open!");
+        mapped_array_control** grown = realloc(controls, (controlCount ? 2 * controlCount : 8) * sizeof(mapped_array_control*));
+        if (!grown) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate mapped array controls!");
+        for (uint i = controlCount; i < (controlCount ? 2 * controlCount : 8); i++) grown[i] = NULL;
+        controlCount = controlCount ? 2 * controlCount : 8;
+        controls = grown;
+    }
+    controls[slot] = control;
+    pthread_mutex_unlock(&controlsLock);
+    return slot;
+}
+static mapped_array_control* mappedArrayGetControl(uint alignment) {
+    pthread_mutex_lock(&controlsLock);
+    mapped_array_control* control = controls[alignment & MAPPED_ARRAY_SLOT_MASK];
+    pthread_mutex_unlock(&controlsLock);
+    return control;
+}
+static void mappedArrayRemoveControl(uint alignment) {
+    pthread_mutex_lock(&controlsLock);
+    controls[alignment & MAPPED_ARRAY_SLOT_MASK] = NULL;
+    pthread_mutex_unlock(&controlsLock);
+}
+
+// Map size bytes of the file of a control block
+static void mappedArrayMap(mapped_array_control* control, size_t size) {
+#ifdef _WIN32
+    control->mapping = CreateFileMappingA(control->file, NULL, control->readOnly ? PAGE_WRITECOPY : PAGE_READWRITE, (DWORD)((uint64)size >> 32), (DWORD)size, NULL);
+    void* view = control->mapping ? MapViewOfFile(control->mapping, control->readOnly ? FILE_MAP_COPY : FILE_MAP_WRITE, 0, 0, size) : NULL;
+    if (!view) SL_throwError("INSUFFICIENT MEMORY - Failed to map %llu bytes of file!", (unsigned long long)size);
+#else
+    void* view = mmap(NULL, size, PROT_READ | PROT_WRITE, control->readOnly ? MAP_PRIVATE : MAP_SHARED, control->file, 0);
+    if (view == MAP_FAILED) SL_throwError("INSUFFICIENT MEMORY - Failed to map %llu bytes of file!", (unsigned long long)size);
+#endif
+    control->header = view;
+    control->size = size;
+}
+static void mappedArrayUnmap(mapped_array_control* control) {
+#ifdef _WIN32
+    UnmapViewOfFile(control->header);
+    CloseHandle(control->mapping);
+#else
+    munmap(control->header, control->size);
+#endif
+}
+
+void* __SL_openMappedArray(array(void)* a, const char* filePath, size_t elemSize, bool readOnly) {
+    mapped_array_control* control = malloc(sizeof(mapped_array_control));
+    if (!control) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate mapped array!");
+    control->readOnly = readOnly;
+
+    uint64 size;
+#ifdef _WIN32
+    // Sharing both reading and writing lets a file be open several times at once, as on other systems
+    control->file = CreateFileA(filePath, readOnly ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, readOnly ? OPEN_EXISTING : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (control->file == INVALID_HANDLE_VALUE) SL_throwError("File \'%s\' could not be opened.", filePath);
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(control->file, &fileSize);
+    size = fileSize.QuadPart;
+#else
+    control->file = open(filePath, readOnly ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+    if (control->file < 0) SL_throwError("File \'%s\' could not be opened.", filePath);
+    struct stat status;
+    fstat(control->file, &status);
+    size = status.st_size;
+#endif
+
+    // A new file only gets a header (an empty array grows like any other)
+    const bool created = size == 0;
+    if (created) {
+        if (readOnly) SL_throwError("File \'%s\' is empty.", filePath);
+        size = MAPPED_ARRAY_HEADER_SIZE;
+#ifndef _WIN32
+        if (ftruncate(control->file, size)) SL_throwError("File \'%s\' could not be resized.", filePath);
+#endif
+    }
+    if (size < MAPPED_ARRAY_HEADER_SIZE) SL_throwError("File \'%s\' is not a mapped array.", filePath);
+
+    mappedArrayMap(control, size);
+    mapped_array_header* header = control->header;
+    const uint64 capacity = size - MAPPED_ARRAY_HEADER_SIZE;
+    if (created) {
+        memcpy(header->magic, MAPPED_ARRAY_MAGIC, sizeof(header->magic));
+        header->elemSize = elemSize;
+        header->count = 0;
+        header->capacity = capacity;
+    }
+    else {
+        if (memcmp(header->magic, MAPPED_ARRAY_MAGIC, sizeof(header->magic)) || header->count > UINT_MAX) SL_throwError("File \'%s\' is not a mapped array.", filePath);
+        if (header->elemSize != elemSize) SL_throwError("File \'%s\' holds elements of %llu bytes, not %llu.", filePath, (unsigned long long)header->elemSize, (unsigned long long)elemSize);
+        if (capacity / elemSize < header->count) SL_throwError("File \'%s\' is truncated.", filePath);
+    }
+
+    a->data = (uint8*)header + MAPPED_ARRAY_HEADER_SIZE;
+    a->count = (uint)header->count;
+    a->alignment = ARRAY_MAPPED_STORAGE | mappedArrayAddControl(control);
+    a->capa = capacity;
+    return a;
+}
+
+void __SL_flushMappedArray(const array(void)* a) {
+    const mapped_array_control* control = mappedArrayGetControl(a->alignment);
+    if (control->readOnly) return;
+    control->header->count = a->count;
+#ifdef _WIN32
+    FlushViewOfFile(control->header, 0);
+    FlushFileBuffers(control->file);
+#else
+    msync(control->header, control->size, MS_SYNC);
+#endif
+}
+
+void __SL_closeMappedArray(array(void)* a) {
+    const mapped_array_control* control = mappedArrayGetControl(a->alignment);
+    if (!control->readOnly) control->header->count = a->count;
+    __SL_mappedArrayUnmap(a->data, a->alignment);
+    a->data = NULL;
+    a->count = 0;
+    a->alignment = 0;
+    a->capa = 0;
+}
+
+void __SL_mappedArrayUnmap(void* data, uint alignment) {
+    (void)data;
+    mapped_array_control* control = mappedArrayGetControl(alignment);
+    mappedArrayRemoveControl(alignment);
+    mappedArrayUnmap(control);
+#ifdef _WIN32
+    CloseHandle(control->file);
+#else
+    close(control->file);
+#endif
+    free(control);
+}
+
+void __SL_mappedArrayResize(array(void)* a, size_t size) {
+    mapped_array_control* control = mappedArrayGetControl(a->alignment);
+    if (control->readOnly) SL_throwError("Read only mapped arrays cannot be resized!");
+    control->header->count = a->count;
+    const size_t oldSize = control->size, newSize = MAPPED_ARRAY_HEADER_SIZE + size;
+
+#ifdef _WIN32
+    // A mapping cannot change size: map the file again (a larger mapping extends the file)
+    mappedArrayUnmap(control);
+    if (newSize < oldSize) {
+        LARGE_INTEGER end = {.QuadPart = newSize};
+        if (!SetFilePointerEx(control->file, end, NULL, FILE_BEGIN) || !SetEndOfFile(control->file)) SL_throwError("INSUFFICIENT MEMORY - Failed to resize mapped array to %llu bytes!", (unsigned long long)size);
+    }
+    mappedArrayMap(control, newSize);
+#else
+    // The file must cover the mapping before it grows, and the mapping must stop using the end of the file before it shrinks
+    if (newSize > oldSize && ftruncate(control->file, newSize)) SL_throwError("INSUFFICIENT MEMORY - Failed to resize mapped array to %llu bytes!", (unsigned long long)size);
+#ifdef MREMAP_MAYMOVE
+    void* view = mremap(control->header, oldSize, newSize, MREMAP_MAYMOVE);
+    if (view == MAP_FAILED) SL_throwError("INSUFFICIENT MEMORY - Failed to resize mapped array to %llu bytes!", (unsigned long long)size);
+    control->header = view;
+    control->size = newSize;
+#else
+    mappedArrayUnmap(control);
+    mappedArrayMap(control, newSize);
+#endif
+    if (newSize < oldSize && ftruncate(control->file, newSize)) SL_throwError("INSUFFICIENT MEMORY - Failed to resize mapped array to %llu bytes!", (unsigned long long)size);
+#endif
+
+    control->header->capacity = size;
+    a->data = (uint8*)control->header + MAPPED_ARRAY_HEADER_SIZE;
+    a->capa = size;
+}
\ No newline at end of file
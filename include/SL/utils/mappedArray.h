@@ -0,0 +1,74 @@
+#ifndef __SL_UTILS_MAPPED_ARRAY_H__
+#define __SL_UTILS_MAPPED_ARRAY_H__
+
+#include "../structures.h"
+#include "array.h"
+
+// A mapped array is an array(T) whose storage is a file mapped in memory: opening it reads nothing, the pages are
+// loaded from the file when first touched and written back by the system. Every array macro works on it, and growing
+// it grows the file (its data may move, as for any array). The file starts with a header of MAPPED_ARRAY_HEADER_SIZE
+// bytes holding the count, so closing and opening it again gives back the same array at once.
+// The file uses the byte order and the element layout of the machine that wrote it.
+// A file can be open several times at once, in one or several processes: the arrays then share its elements and its
+// saved count, so only one of them should change it while the others read it (growing it does not grow the others).
+
+/// @brief Flag set in the alignment of an array whose storage is a mapped file (the bits below it find what the process knows of the file)
+#define ARRAY_MAPPED_STORAGE 0x40000000u
+/// @brief Size of the header of a mapped array file (the elements follow, aligned on it)
+#define MAPPED_ARRAY_HEADER_SIZE 64
+
+/// @brief Open a file as an array, creating it if needed
+/// @param array The array to fill
+/// @param filePath The path to the file
+/// @param elemSize The size of an array element (must match the one of the file)
+/// @param readOnly Whether changes stay in memory instead of being written to the file
+/// @return The array
+/// @note Consider using "openMappedArray" or "openMappedArray_ReadOnly" macros instead
+void* __SL_openMappedArray(array(void)* array, const char* filePath, size_t elemSize, bool readOnly);
+/// @brief Write the count and the changed elements of a mapped array to its file, and wait for it
+/// @param array The array
+/// @note Consider using "flushMappedArray" macro instead
+void __SL_flushMappedArray(const array(void)* array);
+/// @brief Save the count of a mapped array in its file and close it
+/// @param array The array
+/// @note Consider using "closeMappedArray" macro instead
+void __SL_closeMappedArray(array(void)* array);
+/// @brief Change the size of the storage of a mapped array, and of its file
+/// @param array The array
+/// @param size The new size of the storage in bytes
+/// @note Called by every array function resizing an array
+void __SL_mappedArrayResize(array(void)* array, size_t size);
+/// @brief Close the file of a mapped array, without saving its count
+/// @param data The storage of the array
+/// @param alignment The alignment of the array
+/// @note Called by "destroyArray" and "freeArray"
+void __SL_mappedArrayUnmap(void* data, uint alignment);
+
+/// @brief Open a file as an array ON STACK, creating it (empty) if needed
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param filePath The path to the file
+/// @return The array, whose storage is the file
+/// @note Close it with "closeMappedArray": "destroyArray" does not save its count
+#define openMappedArray(array_type, filePath) (*(array_type*)__SL_openMappedArray((void*)&(array_type){0}, filePath, sizeof(((array_type){0}).data[0]), false))
+/// @brief Open an existing file as an array ON STACK, without ever changing the file
+/// @param array_type The type of the array (Use "array(type)" with the type of the element to store)
+/// @param filePath The path to the file
+/// @return The array, whose storage is the file
+/// @note The elements can still be changed: the changed pages are copied in memory (the array cannot grow)
+#define openMappedArray_ReadOnly(array_type, filePath) (*(array_type*)__SL_openMappedArray((void*)&(array_type){0}, filePath, sizeof(((array_type){0}).data[0]), true))
+/// @brief Write a mapped array to its file, and wait for it
+/// @param array_ The array
+#define flushMappedArray(array_)  __SL_flushMappedArray((void*)&(array_))
+/// @brief Write a mapped array to its file, and wait for it
+/// @param array_ The array
+#define flushMappedArray_(array_) __SL_flushMappedArray((void*) (array_))
+/// @brief Save the count of a mapped array in its file and close it
+/// @param array_ The array
+/// @note The file keeps the capacity of the array
+#define closeMappedArray(array_)  __SL_closeMappedArray((void*)&(array_))
+/// @brief Save the count of a mapped array in its file and close it
+/// @param array_ The array
+/// @note The file keeps the capacity of the array
+#define closeMappedArray_(array_) __SL_closeMappedArray((void*) (array_))
+
+#endif
\ No newline at end of file
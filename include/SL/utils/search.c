@@ -0,0 +1,86 @@
+#include "search.h"
+
+#include <stdlib.h>
+#include <memory.h>
+#include "inout.h"
+
+// Blocks of at most this many keys are finished by counting instead of halving
+#define SEARCH_SCAN 16
+// Size of a cache line
+#define SEARCH_LINE 64
+
+// Position of node k in the sorted array, computed instead of read from memory (it would cost another cache miss).
+// Its position in the perfect tree of the same height, minus the missing leaves of the last level before it.
+static inline uint sortedIndexRank(uint count, uint k) {
+    const uint height = 32 - __builtin_clz(count), depth = 31 - __builtin_clz(k);
+    const uint position = ((2 * (k - (1u << depth)) + 1) << (height - 1 - depth)) - 1;
+    const uint leaves = count - ((1u << (height - 1)) - 1); // Leaves of the last level, the even positions of the perfect tree
+    const uint leavesBefore = (position + 1) / 2;
+    return position - (leavesBefore > leaves ? leavesBefore - leaves : 0);
+}
+
+// "less" is the comparison of a key of the array (x) with the searched key: x < key for lower bounds, x <= key for upper bounds
+#define SEARCH_DEFINE_BOUND(name, type, less) \
+uint name(const type* data, uint count, type key) { \
+    const type* base = data; \
+    uint n = count; \
+    while (n > SEARCH_SCAN) { \
+        const uint half = n / 2; \
+        __builtin_prefetch(base + half / 2); \
+        __builtin_prefetch(base + half + half / 2); \
+        const type x = base[half]; \
+        base = (less) ? base + half : base; \
+        n -= half; \
+    } \
+    uint found = 0; \
+    for (uint i = 0; i < n; i++) { const type x = base[i]; found += (less); } \
+    return (uint)(base - data) + found; \
+}
+
+// Walk down the tree: going right on every key that is too small, the bits of k are the path taken.
+// The answer is the last node where the walk went left, found by removing the trailing right turns (1 bits) and the left one.
+#define SEARCH_DEFINE_INDEX_BOUND(name, type, index_type, less) \
+uint name(const index_type* index, type key) { \
+    const type* keys = index->keys; \
+    const uint count = index->count; \
+    uint64 k = 1; \
+    while (k <= count) { \
+        __builtin_prefetch(keys + k * (SEARCH_LINE / sizeof(type))); \
+        const type x = keys[k]; \
+        k = 2 * k + (less); \
+    } \
+    k >>= __builtin_ffsll(~k); \
+    return k ? sortedIndexRank(count, (uint)k) : count; \
+}
+
+#define SEARCH_DEFINE(type, suffix) \
+    SEARCH_DEFINE_BOUND(__SL_lowerBound_##suffix, type, x < key) \
+    SEARCH_DEFINE_BOUND(__SL_upperBound_##suffix, type, !(key < x)) \
+    SEARCH_DEFINE_INDEX_BOUND(__SL_sortedIndexLowerBound_##suffix, type, suffix##_si, x < key) \
+    SEARCH_DEFINE_INDEX_BOUND(__SL_sortedIndexUpperBound_##suffix, type, suffix##_si, !(key < x))
+
+SEARCH_DEFINE(int,    int)
+SEARCH_DEFINE(uint,   uint)
+SEARCH_DEFINE(int64,  int64)
+SEARCH_DEFINE(uint64, uint64)
+SEARCH_DEFINE(float,  float)
+SEARCH_DEFINE(double, double)
+
+// In order walk of the tree rooted at k, giving it the keys from "next" on
+static uint sortedIndexFill(sortedIndex(void)* index, const uint8* sorted, size_t keySize, uint k, uint next) {
+    while (k <= index->count) {
+        next = sortedIndexFill(index, sorted, keySize, 2 * k, next);
+        memcpy((uint8*)index->keys + (size_t)k * keySize, sorted + (size_t)next * keySize, keySize);
+        next++;
+        k = 2 * k + 1;
+    }
+    return next;
+}
+void* __SL_initSortedIndex(sortedIndex(void)* index, const void* sorted, uint count, size_t keySize) {
+    // Slot 0 is never read: the root is at 1
+    index->keys = __SL_arrayAllocate(((size_t)count + 1) * keySize, SORTED_INDEX_ALIGNMENT);
+    if (!index->keys) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate sorted index of %u keys!", count);
+    index->count = count;
+    sortedIndexFill(index, sorted, keySize, 1, 0);
+    return index;
+}
\ No newline at end of file
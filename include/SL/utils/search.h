@@ -0,0 +1,148 @@
+#ifndef __SL_UTILS_SEARCH_H__
+#define __SL_UTILS_SEARCH_H__
+
+#include "../structures.h"
+#include "array.h"
+
+// Searches in arrays sorted in increasing order (by "arraySort" or "arrayRadixSort") of int, uint, int64, uint64, float or double.
+// The binary search has no branch to mispredict and prefetches both possible next middles, then finishes by counting
+// the keys of the last small block (a loop the compiler vectorizes). The sorted index stores the keys in the order of
+// a breadth first walk of the search tree (Eytzinger layout): the next 3 or 4 levels a search visits share a single
+// cache line, which is prefetched while the current level is compared, so lookups in large tables wait for far fewer misses.
+// The position of the result in the sorted array is computed from its place in the tree, without reading more memory.
+
+/// @brief Find the first key of a sorted array not less than a key
+/// @param data The sorted keys
+/// @param count The number of keys
+/// @param key The key to find
+/// @return The index of the first key >= key (count if there is none)
+/// @note Consider using "arrayLowerBound" macro instead
+uint __SL_lowerBound_int   (const int*    data, uint count, int    key);
+uint __SL_lowerBound_uint  (const uint*   data, uint count, uint   key);
+uint __SL_lowerBound_int64 (const int64*  data, uint count, int64  key);
+uint __SL_lowerBound_uint64(const uint64* data, uint count, uint64 key);
+uint __SL_lowerBound_float (const float*  data, uint count, float  key);
+uint __SL_lowerBound_double(const double* data, uint count, double key);
+/// @brief Find the first key of a sorted array greater than a key
+/// @param data The sorted keys
+/// @param count The number of keys
+/// @param key The key to find
+/// @return The index of the first key > key (count if there is none)
+/// @note Consider using "arrayUpperBound" macro instead
+uint __SL_upperBound_int   (const int*    data, uint count, int    key);
+uint __SL_upperBound_uint  (const uint*   data, uint count, uint   key);
+uint __SL_upperBound_int64 (const int64*  data, uint count, int64  key);
+uint __SL_upperBound_uint64(const uint64* data, uint count, uint64 key);
+uint __SL_upperBound_float (const float*  data, uint count, float  key);
+uint __SL_upperBound_double(const double* data, uint count, double key);
+
+#define __SL_searchFunction(name, pointer) _Generic((pointer), \
+    int*: name##_int, unsigned int*: name##_uint, int64*: name##_int64, uint64*: name##_uint64, float*: name##_float, double*: name##_double)
+
+/// @brief Find the first element of a sorted array not less than a key
+/// @param array_ The array, sorted in increasing order
+/// @param key The key to find
+/// @return The index of the first element >= key (count if there is none)
+#define arrayLowerBound(array_, key)  __SL_searchFunction(__SL_lowerBound, (array_).data) ((array_).data,  (array_).count,  key)
+/// @brief Find the first element of a sorted array not less than a key
+/// @param array_ The array, sorted in increasing order
+/// @param key The key to find
+/// @return The index of the first element >= key (count if there is none)
+#define arrayLowerBound_(array_, key) __SL_searchFunction(__SL_lowerBound, (array_)->data)((array_)->data, (array_)->count, key)
+/// @brief Find the first element of a sorted array greater than a key
+/// @param array_ The array, sorted in increasing order
+/// @param key The key to find
+/// @return The index of the first element > key (count if there is none)
+#define arrayUpperBound(array_, key)  __SL_searchFunction(__SL_upperBound, (array_).data) ((array_).data,  (array_).count,  key)
+/// @brief Find the first element of a sorted array greater than a key
+/// @param array_ The array, sorted in increasing order
+/// @param key The key to find
+/// @return The index of the first element > key (count if there is none)
+#define arrayUpperBound_(array_, key) __SL_searchFunction(__SL_upperBound, (array_)->data)((array_)->data, (array_)->count, key)
+
+
+///// SORTED INDEX
+
+/// @brief Alignment of the keys of a sorted index (one cache line)
+#define SORTED_INDEX_ALIGNMENT 64
+
+#define SL_DEFINE_SORTED_INDEX(type) typedef struct type##_si { type* keys; uint count; } type##_si
+
+/// @brief Read-only search index over the keys of a sorted array
+/// @note keys[k] (k in [1, count]) has children keys[2k] and keys[2k + 1]
+#define sortedIndex(type) type##_si
+
+SL_DEFINE_SORTED_INDEX(void);
+SL_DEFINE_SORTED_INDEX(int);    SL_DEFINE_SORTED_INDEX(uint);
+SL_DEFINE_SORTED_INDEX(int64);  SL_DEFINE_SORTED_INDEX(uint64);
+SL_DEFINE_SORTED_INDEX(float);  SL_DEFINE_SORTED_INDEX(double);
+
+/// @brief Build a sorted index
+/// @param index The index to fill
+/// @param sorted The sorted keys (copied)
+/// @param count The number of keys
+/// @param keySize The size of a key
+/// @return The index
+/// @note Consider using "createSortedIndex" macro instead
+void* __SL_initSortedIndex(sortedIndex(void)* index, const void* sorted, uint count, size_t keySize);
+/// @brief Create a sorted index ON STACK
+/// @param index_type The type of the index (Use "sortedIndex(type)" with the type of the keys)
+/// @param array_ The array to index, sorted in increasing order (not modified, and not needed by the index)
+/// @return The newly created sorted index
+/// @note Takes O(count) time and as much memory as the keys
+#define createSortedIndex(index_type, array_)  (*(index_type*)__SL_initSortedIndex((void*)&(index_type){0}, (array_).data,  (array_).count,  __elemSize(array_)))
+/// @brief Create a sorted index ON STACK
+/// @param index_type The type of the index (Use "sortedIndex(type)" with the type of the keys)
+/// @param array_ The array to index, sorted in increasing order (not modified, and not needed by the index)
+/// @return The newly created sorted index
+/// @note Takes O(count) time and as much memory as the keys
+#define createSortedIndex_(index_type, array_) (*(index_type*)__SL_initSortedIndex((void*)&(index_type){0}, (array_)->data, (array_)->count, __elemSize(*array_)))
+/// @brief Destroy a sorted index
+/// @param index_ The index to destroy
+#define destroySortedIndex(index_) (__SL_arrayFreeData((index_).keys, SORTED_INDEX_ALIGNMENT))
+
+/// @brief Find the first key of a sorted index not less than a key
+/// @param index The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key >= key (count if there is none)
+/// @note Consider using "sortedIndexLowerBound" macro instead
+uint __SL_sortedIndexLowerBound_int   (const sortedIndex(int)*    index, int    key);
+uint __SL_sortedIndexLowerBound_uint  (const sortedIndex(uint)*   index, uint   key);
+uint __SL_sortedIndexLowerBound_int64 (const sortedIndex(int64)*  index, int64  key);
+uint __SL_sortedIndexLowerBound_uint64(const sortedIndex(uint64)* index, uint64 key);
+uint __SL_sortedIndexLowerBound_float (const sortedIndex(float)*  index, float  key);
+uint __SL_sortedIndexLowerBound_double(const sortedIndex(double)* index, double key);
+/// @brief Find the first key of a sorted index greater than a key
+/// @param index The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key > key (count if there is none)
+/// @note Consider using "sortedIndexUpperBound" macro instead
+uint __SL_sortedIndexUpperBound_int   (const sortedIndex(int)*    index, int    key);
+uint __SL_sortedIndexUpperBound_uint  (const sortedIndex(uint)*   index, uint   key);
+uint __SL_sortedIndexUpperBound_int64 (const sortedIndex(int64)*  index, int64  key);
+uint __SL_sortedIndexUpperBound_uint64(const sortedIndex(uint64)* index, uint64 key);
+uint __SL_sortedIndexUpperBound_float (const sortedIndex(float)*  index, float  key);
+uint __SL_sortedIndexUpperBound_double(const sortedIndex(double)* index, double key);
+
+/// @brief Find the first key of a sorted index not less than a key
+/// @param index_ The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key >= key (count if there is none)
+#define sortedIndexLowerBound(index_, key)  __SL_searchFunction(__SL_sortedIndexLowerBound, (index_).keys) (&(index_), key)
+/// @brief Find the first key of a sorted index not less than a key
+/// @param index_ The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key >= key (count if there is none)
+#define sortedIndexLowerBound_(index_, key) __SL_searchFunction(__SL_sortedIndexLowerBound, (index_)->keys)(index_, key)
+/// @brief Find the first key of a sorted index greater than a key
+/// @param index_ The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key > key (count if there is none)
+#define sortedIndexUpperBound(index_, key)  __SL_searchFunction(__SL_sortedIndexUpperBound, (index_).keys) (&(index_), key)
+/// @brief Find the first key of a sorted index greater than a key
+/// @param index_ The index
+/// @param key The key to find
+/// @return The index in the sorted array of the first key > key (count if there is none)
+#define sortedIndexUpperBound_(index_, key) __SL_searchFunction(__SL_sortedIndexUpperBound, (index_)->keys)(index_, key)
+
+#endif
\ No newline at end of file
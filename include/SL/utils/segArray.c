@@ -0,0 +1,17 @@
+#include "segArray.h"
+
+#include <stdlib.h>
+#include "inout.h"
+
+void __SL_destroySegArray(segArray(void)* a) {
+    for (uint i = 0; i < a->blockCount; i++) free(a->blocks[i]);
+    a->blockCount = 0;
+    a->count = 0;
+}
+
+void __SL_segArrayGrow(segArray(void)* a, size_t elemSize) {
+    if (a->blockCount == SEG_ARRAY_MAX_BLOCKS) SL_throwError("Segmented array is full!");
+    void* block = malloc((elemSize << SEG_ARRAY_FIRST_BITS) << a->blockCount);
+    if (!block) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate segmented array block!");
+    a->blocks[a->blockCount++] = block;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef __SL_UTILS_SEG_ARRAY_H__
+#define __SL_UTILS_SEG_ARRAY_H__
+
+#include "../structures.h"
+
+// Segmented array: the elements live in blocks of 16, 32, 64... elements, found through a fixed directory.
+// Growing only allocates the next block, so elements never move: pointers to them stay valid until the array is destroyed.
+// Element i is in block floor(log2(i / 16 + 1)), found with a single bit scan.
+
+/// @brief Number of elements of the first block (log2)
+#define SEG_ARRAY_FIRST_BITS 4
+/// @brief Number of blocks of the directory (enough for 2^32 elements)
+#define SEG_ARRAY_MAX_BLOCKS 29
+
+#define __SL_DEFINE_SEG_ARRAY_0P(type, type_with_p_instead_of_stars_sa) typedef struct type_with_p_instead_of_stars_sa   { type* blocks[SEG_ARRAY_MAX_BLOCKS];    uint count; uint blockCount; } type_with_p_instead_of_stars_sa
+#define __SL_DEFINE_SEG_ARRAY_1P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_sa { type** blocks[SEG_ARRAY_MAX_BLOCKS];   uint count; uint blockCount; } type_with_p_instead_of_stars##_sa
+#define __SL_DEFINE_SEG_ARRAY_2P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_sa { type*** blocks[SEG_ARRAY_MAX_BLOCKS];  uint count; uint blockCount; } type_with_p_instead_of_stars##_sa
+#define __SL_DEFINE_SEG_ARRAY_3P(type, type_with_p_instead_of_stars)    typedef struct type_with_p_instead_of_stars##_sa { type**** blocks[SEG_ARRAY_MAX_BLOCKS]; uint count; uint blockCount; } type_with_p_instead_of_stars##_sa
+#define SL_DEFINE_SEG_ARRAY(type) \
+    __SL_DEFINE_SEG_ARRAY_0P (type, type##_sa ); \
+    __SL_DEFINE_SEG_ARRAY_1P (type, type##p   ); \
+    __SL_DEFINE_SEG_ARRAY_2P (type, type##pp  ); \
+    __SL_DEFINE_SEG_ARRAY_3P (type, type##ppp )
+
+#define segArray(type, ...) type##__VA_ARGS__##_sa
+
+SL_DEFINE_SEG_ARRAY(void);
+
+/// @brief Get the number of elements fitting in the first blocks of a segmented array
+/// @param blockCount The number of blocks
+/// @return The capacity of the blocks
+static ALWAYS_INLINE size_t __SL_segArrayCapacity(uint blockCount) { return (((size_t)1 << blockCount) - 1) << SEG_ARRAY_FIRST_BITS; }
+/// @brief Get the block holding an element of a segmented array
+/// @param index The index of the element
+/// @return The index of the block
+static ALWAYS_INLINE uint __SL_segArrayBlock(uint index) { return 63 - __builtin_clzll((uint64)index + (1 << SEG_ARRAY_FIRST_BITS)) - SEG_ARRAY_FIRST_BITS; }
+/// @brief Get the position of an element of a segmented array in its block
+/// @param index The index of the element
+/// @return The index of the element in its block
+static ALWAYS_INLINE size_t __SL_segArrayOffset(uint index) { const uint64 p = (uint64)index + (1 << SEG_ARRAY_FIRST_BITS); return p ^ ((uint64)1 << (63 - __builtin_clzll(p))); }
+
+/// @brief Create a segmented array ON STACK
+/// @param seg_array_type The type of the segmented array (Use "segArray(type)" with the type of the element to store)
+/// @return The newly created segmented array (no block is allocated until the first element is added)
+#define createSegArray(seg_array_type) ((seg_array_type){0})
+/// @brief Free the blocks of a segmented array
+/// @param array The segmented array
+/// @note Consider using "destroySegArray" or "freeSegArray" macros instead
+void __SL_destroySegArray(segArray(void)* array);
+/// @brief Destroy a segmented array
+/// @param array_ The segmented array to destroy
+#define destroySegArray(array_) __SL_destroySegArray((void*)&(array_))
+/// @brief Create a new segmented array ON HEAP
+/// @param seg_array_type The type of the segmented array (Use "segArray(type)" with the type of the element to store)
+/// @return The newly created segmented array
+#define newSegArray(seg_array_type) ((seg_array_type*)calloc(1, sizeof(seg_array_type)))
+/// @brief Free a segmented array
+/// @param array_ The segmented array to free
+#define freeSegArray(array_) do { __SL_destroySegArray((void*)(array_)); free(array_); } while (0)
+
+/// @brief Allocate the next block of a segmented array
+/// @param array The segmented array
+/// @param elemSize The size of an element
+/// @note The elements already stored do not move
+void __SL_segArrayGrow(segArray(void)* array, size_t elemSize);
+
+/// @brief Access an element of a segmented array
+/// @param array_ The segmented array
+/// @param index The index of the element (evaluated twice)
+#define segArrayAt(array_, index)  ((array_).blocks[__SL_segArrayBlock(index)][__SL_segArrayOffset(index)])
+/// @brief Access an element of a segmented array
+/// @param array_ The segmented array
+/// @param index The index of the element (evaluated twice)
+#define segArrayAt_(array_, index) ((array_)->blocks[__SL_segArrayBlock(index)][__SL_segArrayOffset(index)])
+
+/// @brief Add an element to a segmented array
+/// @param array_ The segmented array to modify
+/// @param ... The value to add
+#define segArrayAdd(array_, ...)  do { if ((array_).count == __SL_segArrayCapacity((array_).blockCount))   __SL_segArrayGrow((void*)&(array_), sizeof((array_).blocks[0][0]));  segArrayAt(array_, (array_).count) = __VA_ARGS__;  (array_).count++; } while (0)
+/// @brief Add an element to a segmented array
+/// @param array_ The segmented array to modify
+/// @param ... The value to add
+#define segArrayAdd_(array_, ...) do { if ((array_)->count == __SL_segArrayCapacity((array_)->blockCount)) __SL_segArrayGrow((void*) (array_), sizeof((array_)->blocks[0][0])); segArrayAt_(array_, (array_)->count) = __VA_ARGS__; (array_)->count++; } while (0)
+
+/// @brief Pop last element of a segmented array
+/// @param array_ The segmented array
+/// @note The blocks are kept for the next elements
+#define segArrayPop(array_)  (--(array_).count, segArrayAt(array_, (array_).count))
+/// @brief Pop last element of a segmented array
+/// @param array_ The segmented array
+/// @note The blocks are kept for the next elements
+#define segArrayPop_(array_) (--(array_)->count, segArrayAt_(array_, (array_)->count))
+
+/// @brief Get last element of a segmented array
+/// @param array_ The segmented array
+#define segArrayLast(array_)  segArrayAt(array_, (array_).count - 1)
+/// @brief Get last element of a segmented array
+/// @param array_ The segmented array
+#define segArrayLast_(array_) segArrayAt_(array_, (array_)->count - 1)
+
+/// @brief Get first element of a segmented array
+/// @param array_ The segmented array
+#define segArrayFirst(array_)  (*(array_).blocks[0])
+/// @brief Get first element of a segmented array
+/// @param array_ The segmented array
+#define segArrayFirst_(array_) (*(array_)->blocks[0])
+
+// A loop over the blocks around a plain pointer loop over each of them. The block loop goes on only if the
+// pointer loop reached its end, so a "break" leaves the whole iteration like in array_foreach.
+#define __SL_segArray_foreach(varname, array_) \
+    for (typeof((array_).blocks[0]) varname = NULL, varname##Max = NULL, *varname##Once = (void*)1; varname##Once; varname##Once = NULL) \
+    for (size_t varname##Block = 0, varname##Left = (array_).count, varname##Size = (size_t)1 << SEG_ARRAY_FIRST_BITS; varname == varname##Max && varname##Left; \
+         varname##Left -= varname##Left < varname##Size ? varname##Left : varname##Size, varname##Block++, varname##Size *= 2) \
+    for (varname = (array_).blocks[varname##Block], varname##Max = varname + (varname##Left < varname##Size ? varname##Left : varname##Size); varname < varname##Max; ++varname)
+/// @brief Iterate over every element in segmented array
+/// @param VARNAME_in_ARRAY Should litteraly the name of the variable used to iterate followed by "in" then the name of the segmented array
+/// @note Use like a while-loop or a for-loop (as it is one)
+#define segArray_foreach(VARNAME_in_ARRAY) __SL_segArray_foreach(VARNAME_in_ARRAY)
+
+#endif
\ No newline at end of file
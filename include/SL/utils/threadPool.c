@@ -0,0 +1,148 @@
+#include "threadPool.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "inout.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+uint SL_getCoreCount() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long count = info.dwNumberOfProcessors;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return count > 0 ? (uint)count : 1;
+}
+
+struct ThreadPool {
+    pthread_t* threads;
+    uint threadCount;       // worker threads (the calling thread also works on each run)
+
+    pthread_mutex_t runLock; // held for the whole run, one run at a time
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+
+    // Current run, only changed under lock while no worker is active
+    func_task task;
+    void* data;
+    uint count;
+    uint next;              // next task index to hand out (atomic)
+    uint active;            // workers inside the current run
+    uint64 generation;      // incremented on every run
+    bool stop;
+};
+
+static void threadPoolWork(thread_pool* pool, func_task task, void* data, uint count) {
+    uint i;
+    while ((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < count) task(data, i);
+}
+
+static void* threadPoolWorker(void* arg) {
+    thread_pool* pool = arg;
+    uint64 seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (true) {
+        while (!pool->stop && pool->generation == seen) pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->stop) break;
+
+        seen = pool->generation;
+        func_task task = pool->task;
+        void* data = pool->data;
+        uint count = pool->count;
+        pool->active++;
+        pthread_mutex_unlock(&pool->lock);
+
+        threadPoolWork(pool, task, data, count);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+thread_pool* newThreadPool(uint threadCount) {
+    if (threadCount == 0) threadCount = SL_getCoreCount();
+
+    thread_pool* new = calloc(1, sizeof(thread_pool));
+    if (!new) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate thread pool!");
+    new->threadCount = threadCount - 1;
+    new->threads = malloc(sizeof(pthread_t) * (new->threadCount + 1));
+    if (!new->threads) SL_throwError("INSUFFICIENT MEMORY - Failed to allocate thread pool!");
+
+    pthread_mutex_init(&new->runLock, NULL);
+    pthread_mutex_init(&new->lock, NULL);
+    pthread_cond_init(&new->wake, NULL);
+    pthread_cond_init(&new->done, NULL);
+
+    for (uint i = 0; i < new->threadCount; i++)
+        if (pthread_create(new->threads + i, NULL, threadPoolWorker, new)) SL_throwError("Failed to create thread %u of thread pool!", i);
+
+    return new;
+}
+void freeThreadPool(thread_pool* toFree) {
+    pthread_mutex_lock(&toFree->lock);
+    toFree->stop = true;
+    pthread_cond_broadcast(&toFree->wake);
+    pthread_mutex_unlock(&toFree->lock);
+    for (uint i = 0; i < toFree->threadCount; i++) pthread_join(toFree->threads[i], NULL);
+
+    pthread_cond_destroy(&toFree->done);
+    pthread_cond_destroy(&toFree->wake);
+    pthread_mutex_destroy(&toFree->lock);
+    pthread_mutex_destroy(&toFree->runLock);
+    free(toFree->threads);
+    free(toFree);
+}
+uint threadPoolGetThreadCount(const thread_pool* pool) {
+    return pool->threadCount + 1;
+}
+
+void threadPoolRun(thread_pool* pool, func_task task, void* data, uint count) {
+    if (count == 0) return;
+
+    // Nothing to share, or nested run: stay on this thread
+    if (pool->threadCount == 0 || count == 1 || pthread_mutex_trylock(&pool->runLock)) {
+        for (uint i = 0; i < count; i++) task(data, i);
+        return;
+    }
+
+    // A worker may still be leaving a previous run it joined late
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pool->task = task;
+    pool->data = data;
+    pool->count = count;
+    pool->next = 0;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    threadPoolWork(pool, task, data, count);
+
+    // Workers that did not join before all tasks were handed out will find nothing left to do
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    pthread_mutex_unlock(&pool->runLock);
+}
+
+static thread_pool* sharedPool = NULL;
+static pthread_once_t sharedPoolOnce = PTHREAD_ONCE_INIT;
+static void createSharedPool() {
+    sharedPool = newThreadPool(0);
+}
+thread_pool* SL_getThreadPool() {
+    pthread_once(&sharedPoolOnce, createSharedPool);
+    return sharedPool;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef __SL_UTILS_THREAD_POOL_H__
+#define __SL_UTILS_THREAD_POOL_H__
+
+#include "../structures.h"
+
+typedef struct ThreadPool thread_pool;
+/// @brief A task run by a thread pool
+/// @param data The data given to threadPoolRun
+/// @param index The index of the task, in [0, count[
+typedef void (*func_task)(void* data, uint index);
+
+/// @brief Get the number of logical cores of the machine
+/// @return The number of cores (at least 1)
+uint SL_getCoreCount();
+
+/// @brief Create a new thread pool
+/// @param threadCount The number of threads working on each run, including the calling one (0 for one per core)
+/// @return The newly created thread pool
+thread_pool* newThreadPool(uint threadCount);
+/// @brief Free a thread pool
+/// @param toFree The thread pool to free
+/// @note Waits for the worker threads to exit
+void freeThreadPool(thread_pool* toFree);
+/// @brief Get the number of threads working on each run of a thread pool
+/// @param pool The thread pool
+/// @return The number of threads, including the calling one
+uint threadPoolGetThreadCount(const thread_pool* pool);
+
+/// @brief Run tasks on a thread pool and wait for all of them to finish
+/// @param pool The thread pool
+/// @param task The task to run
+/// @param data The data given to every task
+/// @param count The number of tasks to run (task is called once for every index in [0, count[)
+/// @note The calling thread works on the tasks too
+/// @note Tasks are handed out one index at a time, so uneven tasks balance themselves
+/// @note If the pool is already running (for example when called from one of its own tasks), runs the tasks on the calling thread
+void threadPoolRun(thread_pool* pool, func_task task, void* data, uint count);
+
+/// @brief Get the thread pool shared by the library
+/// @return The shared thread pool, with one thread per core
+/// @note Created on first use, never freed
+thread_pool* SL_getThreadPool();
+
+#endif
\ No newline at end of file